@@ -0,0 +1,82 @@
+/**
+ * \class ArenaDOMParser
+ *
+ * \brief DOM parser that allocates its documents from a memory manager of their own
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#ifndef ARENA_DOM_PARSER_H_
+#define ARENA_DOM_PARSER_H_
+
+#include <xercesc/parsers/XercesDOMParser.hpp>
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			/**
+			  * The parser state lives on the default memory manager and stays valid
+			  * across documents. Only the documents are allocated from the document
+			  * memory manager, which may be rewound once they are released.
+			  */
+			class ArenaDOMParser : public xercesc::XercesDOMParser
+			{
+				public:
+					/** \brief Constructor of the class
+					  * \param documentMemoryManager 	Memory manager of the documents
+					  * \param grammarPool 				Grammar pool shared with the other parsers
+					  */
+					ArenaDOMParser(xercesc::MemoryManager* const documentMemoryManager,
+					               xercesc::XMLGrammarPool* const grammarPool);
+
+					/** \brief Destructor of the class
+					  */
+					virtual ~ArenaDOMParser();
+
+					virtual void startDocument();
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					ArenaDOMParser(const ArenaDOMParser&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					ArenaDOMParser& operator=(const ArenaDOMParser&);
+
+					/** Memory manager of the documents */
+					xercesc::MemoryManager* documentMemoryManager;
+
+			}; // end of class ArenaDOMParser
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _ARENA_DOM_PARSER_H_
@@ -0,0 +1,143 @@
+/**
+ * \class ArenaMemoryManager
+ *
+ * \brief Xerces memory manager that serves a document from large blocks and releases them at once
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#ifndef ARENA_MEMORY_MANAGER_H_
+#define ARENA_MEMORY_MANAGER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <xercesc/framework/MemoryManager.hpp>
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			/**
+			  * Single deallocations are ignored, all memory is given back at once by
+			  * Reset or when the manager is destroyed. The manager must outlive the
+			  * documents which were allocated from it.
+			  */
+			class ArenaMemoryManager : public xercesc::MemoryManager
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					ArenaMemoryManager();
+
+					/** \brief Destructor of the class, releases all blocks
+					  */
+					virtual ~ArenaMemoryManager();
+
+					/** \brief Returns the manager to be used for exception objects
+					  * \return Xerces default memory manager
+					  */
+					virtual xercesc::MemoryManager* getExceptionMemoryManager();
+
+					/** \brief Allocates memory from the current block
+					  * \param size		Number of bytes to be allocated
+					  * \return Pointer to the allocated memory
+					  */
+					virtual void* allocate(XMLSize_t size);
+
+					/** \brief Memory is released with the whole arena only
+					  * \param p		Pointer to the memory
+					  * \return Nothing
+					  */
+					virtual void deallocate(void* p);
+
+					/** \brief Returns the number of bytes handed out to Xerces
+					  * \return Allocated bytes
+					  */
+					std::uint64_t GetAllocatedBytes() const;
+
+					/** \brief Returns the number of bytes reserved from the heap
+					  * \return Reserved bytes
+					  */
+					std::uint64_t GetReservedBytes() const;
+
+					/** \brief Returns the number of blocks reserved from the heap
+					  * \return Number of blocks
+					  */
+					std::uint32_t GetBlockCount() const;
+
+					/** \brief Gives back all allocations at once, a few regular blocks
+					  *        are kept for the next allocations. Nothing allocated
+					  *        from the arena must be used afterwards.
+					  * \return Nothing
+					  */
+					void Reset();
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					ArenaMemoryManager(const ArenaMemoryManager&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					ArenaMemoryManager& operator=(const ArenaMemoryManager&);
+
+					/** \brief Reserves a new block from the heap
+					  * \param size		Size of the block in bytes
+					  * \return Pointer to the block
+					  */
+					char* AddBlock(std::size_t size);
+
+					/** Regular blocks in use */
+					std::vector<char*> blocks;
+
+					/** Blocks of single large allocations */
+					std::vector<char*> largeBlocks;
+
+					/** Regular blocks kept by Reset for reuse */
+					std::vector<char*> spareBlocks;
+
+					/** Next free byte of the current block */
+					char* current;
+
+					/** Number of free bytes left in the current block */
+					std::size_t remaining;
+
+					/** Bytes handed out to Xerces */
+					std::uint64_t allocatedBytes;
+
+					/** Bytes reserved from the heap */
+					std::uint64_t reservedBytes;
+
+			}; // end of class ArenaMemoryManager
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _ARENA_MEMORY_MANAGER_H_
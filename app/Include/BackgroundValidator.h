@@ -0,0 +1,199 @@
+/**
+ * \class BackgroundValidator
+ *
+ * \brief Validates input files against their schema on background threads
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#ifndef BACKGROUND_VALIDATOR_H_
+#define BACKGROUND_VALIDATOR_H_
+
+#include <vector>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "OpenConfiguratorCli.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			/**
+			  * Validation state of an input file.
+			  */
+			enum class ValidationState : std::uint8_t
+			{
+				PENDING = 0,	///< Not yet claimed by a worker
+				RUNNING,		///< Validation is in progress
+				DONE			///< Result is available
+			};
+
+			/**
+			  * Input file to be validated together with its result.
+			  */
+			class ValidationEntry
+			{
+				public:
+					/** \brief Constructor of the class
+					  * \param file				Name of the file to be validated
+					  * \param schemaFile		Name of the schema file for validation
+					  * \param xmlNamespace		Namespace of the schema file
+					  */
+					ValidationEntry(const std::string& file, const std::string& schemaFile, const std::string& xmlNamespace);
+
+					/** Name of the file to be validated */
+					std::string filePath;
+
+					/** Name of the schema file for validation */
+					std::string schemaFilePath;
+
+					/** Namespace of the schema file */
+					std::string xmlNamespace;
+
+					/** Validation state of the file */
+					ValidationState state;
+
+					/** Result of the validation, valid once the state is DONE */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult result;
+			};
+
+			/**
+			  * The files are added before the workers are started. A file which is
+			  * requested before a worker claimed it is validated by the requesting
+			  * thread, files which were not added are validated on request only.
+			  * The grammar pool has to be locked while the workers run.
+			  */
+			class BackgroundValidator
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					BackgroundValidator();
+
+					/** \brief Destructor of the class, stops the workers
+					  */
+					~BackgroundValidator();
+
+					/** \brief Adds a file to be validated by the workers
+					  * \param file				Name of the file to be validated
+					  * \param schemaFile		Name of the schema file for validation
+					  * \param xmlNamespace		Namespace of the schema file
+					  * \return Nothing
+					  */
+					void AddFile(const std::string& file, const std::string& schemaFile, const std::string& xmlNamespace);
+
+					/** \brief Starts the workers validating the added files in order
+					  * \param workerCount		Number of worker threads
+					  * \return Nothing
+					  */
+					void Start(std::uint32_t workerCount);
+
+					/** \brief Waits for the validation of a file
+					  * \param file				Name of the file
+					  * \param schemaFile		Name of the schema file for validation
+					  * \param xmlNamespace		Namespace of the schema file
+					  * \return CliResult of the validation
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult Wait(const std::string& file,
+					        const std::string& schemaFile,
+					        const std::string& xmlNamespace);
+
+					/** \brief Returns the first failed validation of the workers
+					  * \return CliResult of the failed validation; successful if none failed
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult GetFailure();
+
+					/** \brief Stops the workers after their current file and forgets all files
+					  * \return Nothing
+					  */
+					void Stop();
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					BackgroundValidator(const BackgroundValidator&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					BackgroundValidator& operator=(const BackgroundValidator&);
+
+					/** \brief Validates pending files until all are claimed or the validator is stopped
+					  * \return Nothing
+					  */
+					void Worker();
+
+					/** \brief Validates a file against its schema
+					  * \param entry			File to be validated
+					  * \return CliResult
+					  */
+					static IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult Validate(const ValidationEntry& entry);
+
+					/** \brief Stores the result of a file and wakes up the waiting threads
+					  * \param index			Index of the file
+					  * \param result			Result of the validation
+					  * \return Nothing
+					  */
+					void Complete(std::size_t index, const IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult& result);
+
+					/** Files in validation order */
+					std::vector<ValidationEntry> entries;
+
+					/** Index of the files keyed by file name */
+					std::map<std::string, std::size_t> entryIndices;
+
+					/** Next file to be claimed by a worker */
+					std::size_t nextEntry;
+
+					/** True if the workers are to stop */
+					bool cancelled;
+
+					/** First failed validation */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult failure;
+
+					/** True if a validation failed */
+					bool hasFailure;
+
+					/** Worker threads */
+					std::vector<std::thread> workers;
+
+					/** Serialises access to the files */
+					std::mutex validatorMutex;
+
+					/** Signals completed validations */
+					std::condition_variable entryDone;
+
+			}; // end of class BackgroundValidator
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _BACKGROUND_VALIDATOR_H_
@@ -64,7 +64,6 @@ namespace IndustrialNetwork
 				const std::string kParameterMaxValueXpathExpression = "./maxValue";
 				const std::string kParameterDefaultValueXpathExpression = "./defaultValue";
 				const std::string kParameterActualValueXpathExpression = "./actualValue";
-				const std::string kChildParameterGroupXpathExpression = "./parameterGroup";
 				const std::string kChildParameterRefXpathExpression = "./parameterRef";
 				const std::string kObjectXpathExpression = "/ISO15745ProfileContainer/ISO15745Profile/ProfileBody/ApplicationLayers/ObjectList/Object";
 				const std::string kDynamicChnlXpathExpression = "/ISO15745ProfileContainer/ISO15745Profile/ProfileBody/ApplicationLayers/dynamicChannels/dynamicChannel";
@@ -81,6 +80,7 @@ namespace IndustrialNetwork
 				const std::string kInterfaceRangeXpathExpression = "./rangeList/range";
 				const std::string kModuleNodeXpathExpression = "/ISO15745ProfileContainer/ISO15745Profile/ProfileBody/DeviceManager/moduleManagement/moduleInterface";
 				const std::string kModuleXpathExpression = "./Module";
+				const std::string kAllModulesXpathExpression = "/openCONFIGURATORProject/NetworkConfiguration/NodeCollection/CN/InterfaceList/Interface/Module";
 				const std::string kForcedObjectNodeXpathExpression = "./ForcedObjects/Object";
 				const std::string kErrorCodeComponent = "/openCONFIGURATORErrorCodes/ErrorCodes";
 				const std::string kErrorCode = "./ErrorCode";
@@ -106,12 +106,10 @@ namespace IndustrialNetwork
 				const std::string kFormatStrParameterActualValueXpathExpression = "value";
 				const std::string kFormatStrParameterDefaultValueXpathExpression = "value";
 				const std::string kFormatStrParameterTemplateXpathExpression = "uniqueID,access,templateIDRef";
-				const std::string kFormatStrChildParameterGroupXpathExpression = "uniqueID,conditionalUniqueIDRef,conditionalValue,bitOffset,configParameter,groupLevelVisible";
 				const std::string kFormatStrParameterGroupXpathExpression = "uniqueID,conditionalUniqueIDRef,conditionalValue,bitOffset,configParameter,groupLevelVisible";
 				const std::string kFormatStrChildParameterRefXpathExpression = "uniqueIDRef,access,actualValue,bitOffset";
 				const std::string kFormatStrParameterXpathExpression = "uniqueID,access,templateIDRef";
 				const std::string kFormatStrParameterDataTypeIdRefXpathExpression = "uniqueID,access";
-				const std::string kFormatStrObjectXpathExpression = "index,name,objectType,defaultValue,dataType,accessType,PDOmapping,actualValue,uniqueIDRef,lowLimit,highLimit";
 				const std::string kFormatStrGeneralFeatureXpathExpression = "CFMConfigManager,DLLErrBadPhysMode,DLLErrMacBuffer,DLLFeatureCN,DLLFeatureMN,NMTBootTimeNotActive,NMTCycleTimeGranularity,NMTCycleTimeMax,NMTCycleTimeMin,NMTMinRedCycleTime,NMTEmergencyQueueSize,NMTErrorEntries,NMTExtNmtCmds,NMTFlushArpEntry,NMTIsochronous,NMTNetHostNameSet,NMTMaxCNNodeID,NMTMaxCNNumber,NMTMaxHeartbeats,NMTNodeIDByHW,NMTNodeIDBySW,NMTProductCode,NMTPublishActiveNodes,NMTPublishConfigNodes,NMTPublishEmergencyNew,NMTPublishNodeState,NMTPublishOperational,NMTPublishPreOp1,NMTPublishPreOp2,NMTPublishReadyToOp,NMTPublishStopped,NMTPublishTime,NMTRevisionNo,NWLForward,NWLICMPSupport,NWLIPSupport,PDODynamicMapping,PDOGranularity,PDOMaxDescrMem,PDORPDOChannelObjects,PDORPDOChannels,PDORPDOCycleDataLim,PDORPDOOverallObjects,PDOSelfReceipt,PDOTPDOChannelObjects,PDOTPDOCycleDataLim,PDOTPDOOverallObjects,PHYExtEPLPorts,PHYHubDelay,PHYHubIntegrated,PHYHubJitter,RT1RT1SecuritySupport,RT1RT1Support,RT2RT2Support,SDOClient,SDOCmdFileRead,SDOCmdFileWrite,SDOCmdLinkName,SDOCmdReadAllByIndex,SDOCmdReadByName,SDOCmdReadMultParam,SDOCmdWriteAllByIndex,SDOCmdWriteByName,SDOCmdWriteMultParam,SDOMaxConnections,SDOMaxParallelConnections,SDOSeqLayerTxHistorySize,SDOServer,SDOSupportASnd,SDOSupportPDO,SDOSupportUdpIp,DLLMultiplePReqPRes";
 				const std::string kFormatStrMnFeatureXpathExpression = "DLLErrMNMultipleMN,DLLMNFeatureMultiplex,DLLMNPResChaining,DLLMNFeaturePResTx,NMTMNASnd2SoC,NMTMNBasicEthernet,NMTMNMultiplCycMax,NMTMNPRes2PReq,NMTMNPRes2PRes,NMTMNPResRx2SoA,NMTMNPResTx2SoA,NMTMNSoA2ASndTx,NMTMNSoC2PReq,NMTNetTime,NMTNetTimeIsRealTime,NMTRelativeTime,NMTServiceUdpIp,NMTSimpleBoot,PDOTPDOChannels,NMTMNDNA,NMTMNRedundancy,DLLMNRingRedundancy,NMTMNMaxAsynchronousSlots";
 				const std::string kFormatStrCnFeatureXpathExpression = "DLLCNFeatureMultiplex,DLLCNPResChaining,NMTCNPreOp2ToReady2Op,NMTCNSoC2PReq,NMTCNSetNodeNumberTime,NMTCNDNA,NMTCNMaxAInv";
@@ -119,9 +117,7 @@ namespace IndustrialNetwork
 				const std::string kFormatStrModuleNodeXpathExpression = "childID,type,moduleAddressing,minPosition,maxPosition,minAddress,maxAddress,maxCount";
 				const std::string kFormatStrModuleXpathExpression = "name,position,address,pathToXDC,enabled";
 				const std::string kFormatStrxPathExpressionObject = "index,subindex";
-				const std::string kFormatStrObjectXpathExpressionModule = "index,name,objectType,defaultValue,dataType,accessType,PDOmapping,actualValue,uniqueIDRef,lowLimit,highLimit,rangeSelector";
 				const std::string kFormatStrDynamicChnlXpathExpressionModule = "dataType,accessType,startIndex,endIndex,maxNumber,addressOffset,bitAlignment";
-				const std::string kFormatStrSubObjectXpathExpression = "subIndex,name,objectType,defaultValue,dataType,accessType,PDOmapping,actualValue,uniqueIDRef,lowLimit,highLimit";
 				const std::string kFormatStrInterfaceXdcXpathExpression = "uniqueID,type,moduleAddressing,maxModules,unusedSlots,multipleModules";
 				const std::string kFormatStrInterfaceRangeXpathExpression = "name,baseIndex,maxIndex,maxSubIndex,sortMode,sortNumber,PDOmapping,sortStep";
 				const std::string kFormatStrAppLayerInterfaceXpathExpression = "uniqueIDRef";
@@ -63,7 +63,16 @@ namespace IndustrialNetwork
 				const std::string kMsgErrorTableNotLoaded[] = { "Failed to load error code table.", "Die Fehlercodetabelle konnte nicht geladen werden." };
 				const std::string kMsgErrorInfoNotFound[] = { "Failed to find error information.", "Die Fehlerinformation konnte nicht gefunden werden." };
 				const std::string kMsgConfGenerationSuccess[] = { "POWERLINK configuration files generated successfully under \"%s\".", "POWERLINK Konfigurationsdateien wurden unter \"%s\" erfolgreich erstellt." };
+				const std::string kMsgInvalidValue[] = { "Value \"%s\" is invalid.", "Der Wert \"%s\" ist ungueltig." };
+				const std::string kMsgUniqueIdRefNotFound[] = { "Referenced uniqueID \"%s\" not found.", "Die referenzierte uniqueID \"%s\" wurde nicht gefunden." };
+				const std::string kMsgInvalidJobCount[] = { "Number of jobs \"%s\" is invalid.", "Die Anzahl der Jobs \"%s\" ist ungueltig." };
 				const std::string kMsgXmlValidationError[] = { "XML validation error at at line %llu column %llu: %s.", "XML Validierungsfehler in Zeile %llu Spalte %llu: %s." };
+				const std::string kMsgDocumentMemoryUsage[] = { "Document \"%s\" used %llu bytes, its parser reserved %llu bytes.", "Das Dokument \"%s\" belegte %llu Bytes, sein Parser reservierte %llu Bytes." };
+				const std::string kMsgInvalidValidationLevel[] = { "Validation level \"%s\" is invalid.", "Die Validierungsstufe \"%s\" ist ungueltig." };
+				const std::string kMsgOutputFileNotWritten[] = { "Output file \"%s\" could not be written.", "Die Ausgabedatei \"%s\" konnte nicht geschrieben werden." };
+				const std::string kMsgValidationCacheDirectoryNotFound[] = { "Validation cache directory is missing.", "Das Verzeichnis des Validierungscaches fehlt." };
+				const std::string kMsgValidationNotCached[] = { "Validation \"%s\" could not be recorded in the cache.", "Die Validierung \"%s\" konnte nicht im Cache gespeichert werden." };
+				const std::string kMsgDeviceTemplateNotExtracted[] = { "Device template of XDC \"%s\" could not be extracted.", "Die Geraetevorlage der XDC \"%s\" konnte nicht extrahiert werden." };
 
 				/** \brief Functionalities to handle the error messages
 				  */
@@ -37,6 +37,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define CONFIGURATION_GENERATOR_CLI_H_
 
 #include "OpenConfiguratorCli.h"
+#include "OutputFileWriter.h"
 
 namespace IndustrialNetwork
 {
@@ -70,63 +71,73 @@ namespace IndustrialNetwork
 				private:
 					/** \brief Creates Mnobd configuration files
 					  * \param outputPath		Output path of the configuraiton files
+					  * \param writer			Writer the files are queued to
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult BuildConciseDeviceConfiguration(const std::string& outputPath);
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult BuildConciseDeviceConfiguration(const std::string& outputPath,
+					        OutputFileWriter& writer);
 
 					/** \brief Creates process images
 					  * \param outputPath		Output path of the image files
+					  * \param writer			Writer the files are queued to
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult BuildProcessImageDescriptions(const std::string& outputPath);
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult BuildProcessImageDescriptions(const std::string& outputPath,
+					        OutputFileWriter& writer);
 
 					/** \brief Creates mnobd.txt
 					  * \param outputPath		Output path of the image files
-					  * \param configuration	Configuration output to be copied
+					  * \param configuration	Configuration output, its content is taken over
+					  * \param writer			Writer the files are queued to
 					  * \return CliResult
 					  */
 					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateMnobdTxt(const std::string& outputPath,
-					        const std::string& configuration);
+					        std::string& configuration, OutputFileWriter& writer);
 
 					/** \brief Creates mnobd.cdc
 					  * \param outputPath		Output path of the image files
-					  * \param buffer			Buffer output to be coiped
+					  * \param binOutput		Binary configuration to be written
+					  * \param writer			Writer the files are queued to
 					  * \return CliResult
 					  */
 					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateMnobdCdc(const std::string& outputPath,
-					        const std::ostringstream& buffer);
+					        const std::shared_ptr<const std::vector<std::uint8_t> >& binOutput, OutputFileWriter& writer);
 
 					/** \brief Creates mnobdhex.txt
 					  * \param outputPath		Output path of the image files
-					  * \param buffer			Buffer output to be coiped
+					  * \param binOutput		Binary configuration to be written as hex text
+					  * \param writer			Writer the files are queued to
 					  * \return CliResult
 					  */
 					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateMnobdHexTxt(const std::string& outputPath,
-					        const std::ostringstream& buffer);
+					        const std::shared_ptr<const std::vector<std::uint8_t> >& binOutput, OutputFileWriter& writer);
 
 					/** \brief Creates CProcess image file
 					  * \param nodeId			Node for which the process to be created
 					  * \param outputPath		Output path of the image files
+					  * \param writer			Writer the files are queued to
 					  * \return CliResult
 					  */
 					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateCProcessImage(const std::uint8_t nodeId,
-					        const std::string& outputPath);
+					        const std::string& outputPath, OutputFileWriter& writer);
 
 					/** \brief Creates XML process image file
 					  * \param nodeId			Node for which the process to be created
 					  * \param outputPath		Output path of the image files
+					  * \param writer			Writer the files are queued to
 					  * \return CliResult
 					  */
 					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateXmlProcessImage(const std::uint8_t nodeId,
-					        const std::string& outputPath);
+					        const std::string& outputPath, OutputFileWriter& writer);
 
 					/** \brief Creates CSharp process image file
 					  * \param nodeId			Node for which the process to be created
 					  * \param outputPath		Output path of the image files
+					  * \param writer			Writer the files are queued to
 					  * \return CliResult
 					  */
 					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateCSharpProcessImage(const std::uint8_t nodeId,
-					        const std::string& outputPath);
+					        const std::string& outputPath, OutputFileWriter& writer);
 
 			}; // end of class ConfigurationGenerator
 		} // end of namespace Application
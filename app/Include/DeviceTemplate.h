@@ -0,0 +1,591 @@
+/**
+ * \file DeviceTemplate
+ *
+ * \brief Includes the data extracted once from an XDC and replayed
+ *        into the core library for every node using the same XDC content
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#ifndef DEVICE_TEMPLATE_H_
+#define DEVICE_TEMPLATE_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "OpenConfiguratorCore.h"
+#include "IEC_Datatype.h"
+#include "CliResult.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			class XdcVarDeclarationType
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					XdcVarDeclarationType() :
+						attributes(),
+						dataType(IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype::UNDEFINED)
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~XdcVarDeclarationType()
+					{
+					}
+
+					/** Attribute values in the order of kFormatStrStructVarXpathExpression */
+					std::vector<std::string> attributes;
+
+					/** Data type of the variable declaration */
+					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype dataType;
+
+			}; // end of class XdcVarDeclarationType
+
+			class XdcStructType
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					XdcStructType() :
+						attributes(),
+						varDeclarationResult(),
+						varDeclarations()
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~XdcStructType()
+					{
+					}
+
+					/** Attribute values in the order of kFormatStrStructXpathExpression */
+					std::vector<std::string> attributes;
+
+					/** Result of the variable declaration query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult varDeclarationResult;
+
+					/** Variable declarations of the struct */
+					std::vector<XdcVarDeclarationType> varDeclarations;
+
+			}; // end of class XdcStructType
+
+			class XdcArrayType
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					XdcArrayType() :
+						attributes(),
+						dataType(IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype::UNDEFINED),
+						subRangeResult(),
+						subRanges()
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~XdcArrayType()
+					{
+					}
+
+					/** Attribute values in the order of kFormatStrArrayXpathExpression */
+					std::vector<std::string> attributes;
+
+					/** Data type of the array elements */
+					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype dataType;
+
+					/** Result of the subrange query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult subRangeResult;
+
+					/** Attribute values of the subranges in the order of kFormatStrArraySubRangeXpathExpression */
+					std::vector<std::vector<std::string> > subRanges;
+
+			}; // end of class XdcArrayType
+
+			class XdcAllowedRangeType
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					XdcAllowedRangeType() :
+						minValue(""),
+						maxValue("")
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~XdcAllowedRangeType()
+					{
+					}
+
+					/** Minimum value of the range, empty if not available */
+					std::string minValue;
+
+					/** Maximum value of the range, empty if not available */
+					std::string maxValue;
+
+			}; // end of class XdcAllowedRangeType
+
+			class XdcParameterType
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					XdcParameterType() :
+						attributes(),
+						dataType(IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype::UNDEFINED),
+						dataTypeIdRefResult(),
+						dataTypeIdRefs(),
+						allowedValueResult(),
+						allowedValues(),
+						allowedRangeResult(),
+						allowedRanges(),
+						defaultValueResult(),
+						defaultValue(""),
+						actualValueResult(),
+						actualValue("")
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~XdcParameterType()
+					{
+					}
+
+					/** Attribute values in the order of kFormatStrParameterXpathExpression */
+					std::vector<std::string> attributes;
+
+					/** Data type of the parameter */
+					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype dataType;
+
+					/** Result of the dataTypeIDRef query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult dataTypeIdRefResult;
+
+					/** Attribute values of the dataTypeIDRef elements */
+					std::vector<std::vector<std::string> > dataTypeIdRefs;
+
+					/** Result of the allowed values query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult allowedValueResult;
+
+					/** Allowed values of the parameter */
+					std::vector<std::string> allowedValues;
+
+					/** Result of the allowed ranges query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult allowedRangeResult;
+
+					/** Allowed ranges of the parameter */
+					std::vector<XdcAllowedRangeType> allowedRanges;
+
+					/** Result of the default value query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult defaultValueResult;
+
+					/** Default value of the parameter */
+					std::string defaultValue;
+
+					/** Result of the actual value query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult actualValueResult;
+
+					/** Actual value of the parameter */
+					std::string actualValue;
+
+			}; // end of class XdcParameterType
+
+			class XdcParameterGroupType
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					XdcParameterGroupType() :
+						attributes(),
+						parentUniqueId(""),
+						parameterRefResult(),
+						parameterRefs()
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~XdcParameterGroupType()
+					{
+					}
+
+					/** Attribute values in the order of kFormatStrParameterGroupXpathExpression */
+					std::vector<std::string> attributes;
+
+					/** uniqueID of the parent group, empty for groups of the parameter group list */
+					std::string parentUniqueId;
+
+					/** Result of the parameter reference query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult parameterRefResult;
+
+					/** Attribute values of the parameter references in the order of kFormatStrChildParameterRefXpathExpression */
+					std::vector<std::vector<std::string> > parameterRefs;
+
+			}; // end of class XdcParameterGroupType
+
+			class XdcObjectEntryType
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					XdcObjectEntryType() :
+						conversionResult(),
+						indexValue(""),
+						index(0),
+						name(""),
+						objectType(IndustrialNetwork::POWERLINK::Core::ObjectDictionary::ObjectType(0)),
+						defaultValue(""),
+						hasDataType(false),
+						dataType(IndustrialNetwork::POWERLINK::Core::ObjectDictionary::PlkDataType::UNDEFINED),
+						accessType(IndustrialNetwork::POWERLINK::Core::ObjectDictionary::AccessType::UNDEFINED),
+						pdoMapping(IndustrialNetwork::POWERLINK::Core::ObjectDictionary::PDOMapping::UNDEFINED),
+						actualValue(""),
+						uniqueIdRef(""),
+						lowLimit(""),
+						highLimit(""),
+						rangeSelector("")
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~XdcObjectEntryType()
+					{
+					}
+
+					/** Result of converting the attributes, reported when the entry is created */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult conversionResult;
+
+					/** Index or sub-index as written in the XDC */
+					std::string indexValue;
+
+					/** Index of the object or sub-index of the sub-object */
+					std::uint32_t index;
+
+					/** Name of the entry */
+					std::string name;
+
+					/** Object type of the entry */
+					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::ObjectType objectType;
+
+					/** Default value of the entry */
+					std::string defaultValue;
+
+					/** true if the dataType attribute is available */
+					bool hasDataType;
+
+					/** Data type of the entry */
+					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::PlkDataType dataType;
+
+					/** Access type of the entry */
+					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::AccessType accessType;
+
+					/** PDO mapping of the entry */
+					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::PDOMapping pdoMapping;
+
+					/** Actual value of the entry, empty for read only and constant entries */
+					std::string actualValue;
+
+					/** Unique ID of the referenced parameter, empty if not available */
+					std::string uniqueIdRef;
+
+					/** Low limit of the entry, empty if not available */
+					std::string lowLimit;
+
+					/** High limit of the entry, empty if not available */
+					std::string highLimit;
+
+					/** Range selector of module objects, empty if not available */
+					std::string rangeSelector;
+
+			}; // end of class XdcObjectEntryType
+
+			class XdcObjectType
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					XdcObjectType() :
+						entry(),
+						subObjectResult(),
+						subObjects()
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~XdcObjectType()
+					{
+					}
+
+					/** Typed attributes of the object */
+					XdcObjectEntryType entry;
+
+					/** Result of the sub-object query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult subObjectResult;
+
+					/** Typed attributes of the sub-objects */
+					std::vector<XdcObjectEntryType> subObjects;
+
+			}; // end of class XdcObjectType
+
+			class XdcAppLayerInterfaceType
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					XdcAppLayerInterfaceType() :
+						attributes(),
+						rangeResult(),
+						ranges()
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~XdcAppLayerInterfaceType()
+					{
+					}
+
+					/** Attribute values in the order of kFormatStrAppLayerInterfaceXpathExpression */
+					std::vector<std::string> attributes;
+
+					/** Result of the range query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult rangeResult;
+
+					/** Attribute values of the ranges in the order of kFormatStrInterfaceRangeXpathExpression */
+					std::vector<std::vector<std::string> > ranges;
+
+			}; // end of class XdcAppLayerInterfaceType
+
+			/** \brief Kinds of elements that are referred by their uniqueID
+			  */
+			enum class XdcUniqueIdKind : std::uint8_t
+			{
+				STRUCT = 0,				/** Struct data type */
+				ARRAY,					/** Array data type */
+				PARAMETER_TEMPLATE,		/** Parameter template */
+				PARAMETER,				/** Parameter */
+				PARAMETER_GROUP			/** Parameter group */
+			};
+
+			class XdcUniqueIdType
+			{
+				public:
+					/** \brief Constructor of the class
+					  * \param kind 			Kind of the element
+					  * \param position 		Position of the element in its list of the device template
+					  */
+					XdcUniqueIdType(const XdcUniqueIdKind kind, const std::size_t position) :
+						kind(kind),
+						position(position)
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~XdcUniqueIdType()
+					{
+					}
+
+					/** Kind of the element */
+					XdcUniqueIdKind kind;
+
+					/** Position of the element in its list of the device template */
+					std::size_t position;
+
+			}; // end of class XdcUniqueIdType
+
+			class DeviceTemplate
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					DeviceTemplate() :
+						structResult(),
+						structs(),
+						arrayResult(),
+						arrays(),
+						parameterTemplateResult(),
+						parameterTemplates(),
+						parameterResult(),
+						parameters(),
+						parameterGroupResult(),
+						parameterGroups(),
+						objectResult(),
+						objects(),
+						dynamicChannelResult(),
+						dynamicChannels(),
+						generalFeatureResult(),
+						generalFeatures(),
+						mnFeatureResult(),
+						mnFeatures(),
+						cnFeatureResult(),
+						cnFeatures(),
+						interfaceResult(),
+						interfaces(),
+						appLayerInterfaceResult(),
+						appLayerInterfaces(),
+						moduleInterfaceResult(),
+						moduleInterfaces(),
+						uniqueIds()
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~DeviceTemplate()
+					{
+					}
+
+					/** \brief Gets a parameter or parameter template by its uniqueID
+					  * \param uniqueId 		uniqueID of the parameter or parameter template
+					  * \param isTemplate 	Gets a parameter template if true
+					  * \return Parameter, NULL if not available
+					  */
+					const XdcParameterType* FindParameter(const std::string& uniqueId, const bool isTemplate) const
+					{
+						std::unordered_map<std::string, XdcUniqueIdType>::const_iterator it = uniqueIds.find(uniqueId);
+						if (it == uniqueIds.end())
+						{
+							return NULL;
+						}
+
+						if (isTemplate && (it->second.kind == XdcUniqueIdKind::PARAMETER_TEMPLATE))
+						{
+							return &parameterTemplates.at(it->second.position);
+						}
+
+						if (!isTemplate && (it->second.kind == XdcUniqueIdKind::PARAMETER))
+						{
+							return &parameters.at(it->second.position);
+						}
+
+						return NULL;
+					}
+
+					/** Result of the struct data type extraction */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult structResult;
+
+					/** Struct data types of the device */
+					std::vector<XdcStructType> structs;
+
+					/** Result of the array data type extraction */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult arrayResult;
+
+					/** Array data types of the device */
+					std::vector<XdcArrayType> arrays;
+
+					/** Result of the parameter template extraction */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult parameterTemplateResult;
+
+					/** Parameter templates of the device */
+					std::vector<XdcParameterType> parameterTemplates;
+
+					/** Result of the parameter list extraction */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult parameterResult;
+
+					/** Parameters of the device */
+					std::vector<XdcParameterType> parameters;
+
+					/** Result of the parameter group extraction */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult parameterGroupResult;
+
+					/** Parameter groups of the device at all nesting levels, each parent before its children */
+					std::vector<XdcParameterGroupType> parameterGroups;
+
+					/** Result of the object list extraction */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult objectResult;
+
+					/** Objects of the device */
+					std::vector<XdcObjectType> objects;
+
+					/** Result of the dynamic channel extraction */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult dynamicChannelResult;
+
+					/** Attribute values of the dynamic channels in the order of kFormatStrDynamicChnlXpathExpressionModule */
+					std::vector<std::vector<std::string> > dynamicChannels;
+
+					/** Result of the general features extraction */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult generalFeatureResult;
+
+					/** Attribute values of the general features in the order of kFormatStrGeneralFeatureXpathExpression */
+					std::vector<std::vector<std::string> > generalFeatures;
+
+					/** Result of the MN features extraction */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult mnFeatureResult;
+
+					/** Attribute values of the MN features in the order of kFormatStrMnFeatureXpathExpression */
+					std::vector<std::vector<std::string> > mnFeatures;
+
+					/** Result of the CN features extraction */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult cnFeatureResult;
+
+					/** Attribute values of the CN features in the order of kFormatStrCnFeatureXpathExpression */
+					std::vector<std::vector<std::string> > cnFeatures;
+
+					/** Result of the interface extraction of a modular head node */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult interfaceResult;
+
+					/** Attribute values of the interfaces in the order of kFormatStrInterfaceXdcXpathExpression */
+					std::vector<std::vector<std::string> > interfaces;
+
+					/** Result of the application layer interface extraction of a modular head node */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult appLayerInterfaceResult;
+
+					/** Application layer interfaces of a modular head node */
+					std::vector<XdcAppLayerInterfaceType> appLayerInterfaces;
+
+					/** Result of the module interface extraction of a module */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult moduleInterfaceResult;
+
+					/** Attribute values of the module interfaces in the order of kFormatStrModuleNodeXpathExpression */
+					std::vector<std::vector<std::string> > moduleInterfaces;
+
+					/** Elements of the application process keyed by their uniqueID */
+					std::unordered_map<std::string, XdcUniqueIdType> uniqueIds;
+
+			}; // end of class DeviceTemplate
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _DEVICE_TEMPLATE_H_
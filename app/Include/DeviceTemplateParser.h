@@ -0,0 +1,378 @@
+/**
+ * \class DeviceTemplateParser
+ *
+ * \brief Extracts the device template of an XDC which is replayed into
+ *        the core library for every node using the same XDC content
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#ifndef DEVICE_TEMPLATE_PARSER_H_
+#define DEVICE_TEMPLATE_PARSER_H_
+
+#include <map>
+#include <exception>
+#include <atomic>
+
+#include "OpenConfiguratorCli.h"
+#include "ParserElement.h"
+#include "DeviceTemplate.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			/** Typed fields of an object or sub-object entry */
+			enum class XdcObjectField : std::uint8_t
+			{
+				INDEX = 0,
+				NAME,
+				OBJECT_TYPE,
+				DEFAULT_VALUE,
+				DATA_TYPE,
+				ACCESS_TYPE,
+				PDO_MAPPING,
+				ACTUAL_VALUE,
+				UNIQUE_ID_REF,
+				LOW_LIMIT,
+				HIGH_LIMIT,
+				RANGE_SELECTOR
+			};
+
+			/** XDC attribute of an object entry and the field it is stored in */
+			struct XdcObjectFieldType
+			{
+				const char* attributeName;
+				XdcObjectField field;
+			};
+
+			class DeviceTemplateParser
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					DeviceTemplateParser();
+
+					/** \brief Destructor of the class
+					  */
+					~DeviceTemplateParser();
+
+					/** \brief Creates single instance
+					  * \return Static instance of the class
+					  */
+					static DeviceTemplateParser& GetInstance();
+
+					/** \brief Extracts the device template from the XDC
+					  * \param element 			Element that contains handle of XDC
+					  * \param deviceTemplate 	Device template output
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateDeviceTemplate(const ParserElement& element,
+					        DeviceTemplate& deviceTemplate);
+
+					/** \brief Computes the key identifying the content of a file
+					  * \param fileName 		Name of the file with path
+					  * \param contentKey 		Hash and size of the file content output
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult GetContentKey(const std::string& fileName,
+					        std::string& contentKey);
+
+					/** \brief Computes the key identifying the content of several files
+					  *        hashed one after the other
+					  * \param fileNames 		Names of the files with path, in hash order
+					  * \param contentKey 		Hash and total size of the file contents output
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult GetContentKey(const std::vector<std::string>& fileNames,
+					        std::string& contentKey);
+
+					/** \brief Reserves threads of the extraction budget, which holds
+					  *        as many threads as jobs are requested
+					  * \param count 	Number of threads wanted
+					  * \return Number of threads granted, may be less than wanted
+					  */
+					std::size_t ReserveThreads(const std::size_t count);
+
+					/** \brief Gives reserved threads back to the extraction budget
+					  * \param count 	Number of threads granted by ReserveThreads
+					  * \return Nothing
+					  */
+					void ReleaseThreads(const std::size_t count);
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					DeviceTemplateParser(const DeviceTemplateParser&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					DeviceTemplateParser& operator=(const DeviceTemplateParser&);
+
+					/** \brief Fills the data types, templates, parameter groups and
+					  *        parameters of an ApplicationProcess element
+					  * \param node 				ApplicationProcess node
+					  * \param deviceTemplate 	Device template output
+					  * \return Nothing
+					  */
+					void VisitApplicationProcess(const xercesc::DOMNode* node,
+					                             DeviceTemplate& deviceTemplate);
+
+					/** \brief Fills the objects, dynamic channels and application layer
+					  *        interfaces of an ApplicationLayers element
+					  * \param node 				ApplicationLayers node
+					  * \param deviceTemplate 	Device template output
+					  * \return Nothing
+					  */
+					void VisitApplicationLayers(const xercesc::DOMNode* node,
+					                            DeviceTemplate& deviceTemplate);
+
+					/** \brief Fills the general, MN and CN features of a NetworkManagement element
+					  * \param node 				NetworkManagement node
+					  * \param deviceTemplate 	Device template output
+					  * \return Nothing
+					  */
+					void VisitNetworkManagement(const xercesc::DOMNode* node,
+					                            DeviceTemplate& deviceTemplate);
+
+					/** \brief Fills the interfaces and module interfaces of a DeviceManager element
+					  * \param node 				DeviceManager node
+					  * \param deviceTemplate 	Device template output
+					  * \return Nothing
+					  */
+					void VisitDeviceManager(const xercesc::DOMNode* node,
+					                        DeviceTemplate& deviceTemplate);
+
+					/** \brief Extracts a struct data type and its variable declarations
+					  * \param node 				Struct node
+					  * \param deviceTemplate 	Device template output
+					  * \return Nothing
+					  */
+					void ExtractStructType(const xercesc::DOMNode* node,
+					                       DeviceTemplate& deviceTemplate);
+
+					/** \brief Extracts an array data type and its subranges
+					  * \param node 				Array node
+					  * \param deviceTemplate 	Device template output
+					  * \return Nothing
+					  */
+					void ExtractArrayType(const xercesc::DOMNode* node,
+					                      DeviceTemplate& deviceTemplate);
+
+					/** \brief Extracts a parameter template or a parameter
+					  * \param node 				Parameter node
+					  * \param formatString 		Attribute names of the parameter
+					  * \param dataTypeIdRefFormat 	Attribute names of the dataTypeIDRef elements
+					  * \param isTemplate 			Extracts a parameter template if true
+					  * \param deviceTemplate 		Device template output
+					  * \return Nothing
+					  */
+					void ExtractParameter(const xercesc::DOMNode* node,
+					                      const std::string& formatString,
+					                      const std::string& dataTypeIdRefFormat,
+					                      const bool isTemplate,
+					                      DeviceTemplate& deviceTemplate);
+
+					/** \brief Extracts the allowed, default and actual values of a parameter
+					  * \param node 			Parameter node
+					  * \param parameter 		Parameter output
+					  * \return Nothing
+					  */
+					void ExtractParameterValues(const xercesc::DOMNode* node,
+					                            XdcParameterType& parameter);
+
+					/** \brief Extracts the allowed values and ranges of a parameter
+					  * \param node 			allowedValues node
+					  * \param parameter 		Parameter output
+					  * \return Nothing
+					  */
+					void ExtractAllowedValues(const xercesc::DOMNode* node,
+					                          XdcParameterType& parameter);
+
+					/** \brief Extracts a parameter group with its nested groups and references, without recursion
+					  * \param node 				Parameter group node
+					  * \param deviceTemplate 	Device template output
+					  * \return Nothing
+					  */
+					void ExtractParameterGroup(const xercesc::DOMNode* node,
+					                           DeviceTemplate& deviceTemplate);
+
+					/** \brief Adds an element to the uniqueID index of the device template
+					  * \param uniqueId 			uniqueID of the element
+					  * \param kind 				Kind of the element
+					  * \param position 			Position of the element in its list
+					  * \param deviceTemplate 	Device template output
+					  * \return Nothing
+					  */
+					static void AddUniqueId(const std::string& uniqueId,
+					                        const XdcUniqueIdKind kind,
+					                        const std::size_t position,
+					                        DeviceTemplate& deviceTemplate);
+
+					/** \brief Extracts the objects of an object list, large lists are
+					  *        split into chunks extracted by several threads
+					  * \param node 				Object list node
+					  * \param deviceTemplate 	Device template output
+					  * \return Nothing
+					  */
+					void ExtractObjectList(const xercesc::DOMNode* node,
+					                       DeviceTemplate& deviceTemplate);
+
+					/** \brief Extracts a chunk of objects on a worker thread
+					  * \param objectNodes 		Object nodes of the list in document order
+					  * \param begin 			Index of the first object of the chunk
+					  * \param end 				Index behind the last object of the chunk
+					  * \param objects 			Objects of the chunk output
+					  * \param error 			Exception thrown by the extraction output
+					  * \return Nothing
+					  */
+					void ExtractObjectChunk(const std::vector<const xercesc::DOMNode*>& objectNodes,
+					                        const std::size_t begin,
+					                        const std::size_t end,
+					                        std::vector<XdcObjectType>& objects,
+					                        std::exception_ptr& error);
+
+					/** \brief Extracts a range of objects
+					  * \param objectNodes 		Object nodes of the list in document order
+					  * \param begin 			Index of the first object
+					  * \param end 				Index behind the last object
+					  * \param objects 			Objects output
+					  * \return Nothing
+					  */
+					void ExtractObjects(const std::vector<const xercesc::DOMNode*>& objectNodes,
+					                    const std::size_t begin,
+					                    const std::size_t end,
+					                    std::vector<XdcObjectType>& objects);
+
+					/** \brief Extracts an object and its sub-objects
+					  * \param node 				Object node
+					  * \param objects 			Objects output
+					  * \return Nothing
+					  */
+					void ExtractObject(const xercesc::DOMNode* node,
+					                   std::vector<XdcObjectType>& objects);
+
+					/** \brief Extracts an application layer interface and its ranges
+					  * \param node 				Interface node
+					  * \param deviceTemplate 	Device template output
+					  * \return Nothing
+					  */
+					void ExtractAppLayerInterface(const xercesc::DOMNode* node,
+					                              DeviceTemplate& deviceTemplate);
+
+					/** \brief Extracts the typed attributes of an object or sub-object
+					  * \param node 				Object or sub-object node
+					  * \param fields 			Field table of the attributes
+					  * \param attributeNames 	Attribute names in the order of the field table
+					  * \param entry 			Entry output
+					  * \return true if the node has attributes; false otherwise
+					  */
+					bool ExtractObjectEntry(const xercesc::DOMNode* node,
+					                        const XdcObjectFieldType* fields,
+					                        const std::vector<std::basic_string<XMLCh> >& attributeNames,
+					                        XdcObjectEntryType& entry);
+
+					/** \brief Converts an attribute value into a field of an object entry
+					  * \param field 		Field to be set
+					  * \param value 		Attribute value
+					  * \param entry 		Entry output
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult SetObjectField(const XdcObjectField field,
+					        const std::string& value,
+					        XdcObjectEntryType& entry);
+
+					/** \brief Extracts the attribute values of the child elements with a name
+					  * \param node 				Parent node
+					  * \param childName 			Name of the child elements
+					  * \param xPathExpression 	Xpath expression reported if no child is found
+					  * \param formatString 		Attribute names to be extracted
+					  * \param rows 				Attribute values output
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult ExtractChildRows(const xercesc::DOMNode* node,
+					        const std::string& childName,
+					        const std::string& xPathExpression,
+					        const std::string& formatString,
+					        std::vector<std::vector<std::string> >& rows);
+
+					/** \brief Gets the attribute values of a node in the order of a format string
+					  * \param node 			Element node
+					  * \param formatString 	Attribute names to be extracted
+					  * \param row 			Attribute values output
+					  * \return true if the node has attributes; false otherwise
+					  */
+					bool GetAttributeRow(const xercesc::DOMNode* node,
+					                     const std::string& formatString,
+					                     std::vector<std::string>& row);
+
+					/** \brief Gets the local name of an element node
+					  * \param node 			DOM node
+					  * \return Name of the element, empty for other node types
+					  */
+					std::string GetElementName(const xercesc::DOMNode* node);
+
+					/** \brief Gets the result of an XPath query without match
+					  * \param xPathExpression 	Xpath expression of the query
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult GetNoResult(const std::string& xPathExpression);
+
+					/** \brief Gets the IEC_Datatype based on the string retrieved from XDC
+					  * \param dataType Specifies the dataType value of object or parameter
+					  * \return IEC_Datatype
+					  */
+					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype GetDataType(const std::string& dataType);
+
+					/** \brief Gets the IEC_Datatype of object or sub-object
+					  *        based on element in XDC
+					  * \param node 		Instance of DOMNode
+					  * \return IEC_Datatype
+					  */
+					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype GetIecDataType(const xercesc::DOMNode* node);
+
+					/** Attribute names of the format strings keyed by format string */
+					std::map<std::string, std::vector<std::basic_string<XMLCh> > > attributeNameMap;
+
+					/** Attribute names of the object field table */
+					std::vector<std::basic_string<XMLCh> > objectAttributeNames;
+
+					/** Attribute names of the sub-object field table */
+					std::vector<std::basic_string<XMLCh> > subObjectAttributeNames;
+
+					/** Threads of the budget in use by validation and prefetch workers and object chunks */
+					std::atomic<std::size_t> reservedThreads;
+
+			}; // end of class DeviceTemplateParser
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _DEVICE_TEMPLATE_PARSER_H_
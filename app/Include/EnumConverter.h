@@ -0,0 +1,167 @@
+/**
+ * \class EnumConverter
+ *
+ * \brief Converts enumerated attribute values of XDC files through perfect hash tables
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#ifndef ENUM_CONVERTER_H_
+#define ENUM_CONVERTER_H_
+
+#include <cstdint>
+#include <string>
+
+#include "OpenConfiguratorCore.h"
+#include "IEC_Datatype.h"
+#include "ParameterAccess.h"
+#include "AccessType.h"
+#include "PDOMapping.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			/** Slot of a perfect hash table, name is NULL for an unused slot */
+			template <typename T>
+			struct EnumEntryType
+			{
+				const char* name;
+				T value;
+			};
+
+			class EnumConverter
+			{
+				public:
+					/** \brief Converts a data type name to an IEC data type
+					  * \param value 	Data type name of the XDC
+					  * \param result 	Converted data type, unchanged if the name is unknown
+					  * \return true if the name is known; false otherwise
+					  */
+					static bool ToIecDataType(const std::string& value,
+					                          IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype& result);
+
+					/** \brief Converts an access value of a parameter
+					  * \param value 	Access value of the XDC
+					  * \param result 	Converted access, unchanged if the value is unknown
+					  * \return true if the value is known; false otherwise
+					  */
+					static bool ToParameterAccess(const std::string& value,
+					                              IndustrialNetwork::POWERLINK::Core::ObjectDictionary::ParameterAccess& result);
+
+					/** \brief Converts an access type of an object or sub-object
+					  * \param value 	Access type of the XDC
+					  * \param result 	Converted access type, unchanged if the value is unknown
+					  * \return true if the value is known; false otherwise
+					  */
+					static bool ToAccessType(const std::string& value,
+					                         IndustrialNetwork::POWERLINK::Core::ObjectDictionary::AccessType& result);
+
+					/** \brief Converts a PDO mapping of an object, sub-object or range
+					  * \param value 	PDO mapping of the XDC
+					  * \param result 	Converted PDO mapping, unchanged if the value is unknown
+					  * \return true if the value is known; false otherwise
+					  */
+					static bool ToPdoMapping(const std::string& value,
+					                         IndustrialNetwork::POWERLINK::Core::ObjectDictionary::PDOMapping& result);
+
+					/** \brief Converts an access type of a dynamic channel
+					  * \param value 	Access type of the XDC
+					  * \param result 	Converted access type, unchanged if the value is unknown
+					  * \return true if the value is known; false otherwise
+					  */
+					static bool ToDynamicChannelAccessType(const std::string& value,
+					                                       IndustrialNetwork::POWERLINK::Core::ObjectDictionary::DynamicChannelAccessType& result);
+
+					/** \brief Converts a module addressing of a modular device
+					  * \param value 	Module addressing of the XDC
+					  * \param result 	Converted module addressing, unchanged if the value is unknown
+					  * \return true if the value is known; false otherwise
+					  */
+					static bool ToModuleAddressing(const std::string& value,
+					                               IndustrialNetwork::POWERLINK::Core::ModularNode::ModuleAddressing& result);
+
+					/** \brief Converts a sort number of a modular device
+					  * \param value 	Sort number of the XDC
+					  * \param result 	Converted sort number, unchanged if the value is unknown
+					  * \return true if the value is known; false otherwise
+					  */
+					static bool ToSortNumber(const std::string& value,
+					                         IndustrialNetwork::POWERLINK::Core::ModularNode::SortNumber& result);
+
+					/** \brief Converts a sort mode of a modular device
+					  * \param value 	Sort mode of the XDC
+					  * \param result 	Converted sort mode, unchanged if the value is unknown
+					  * \return true if the value is known; false otherwise
+					  */
+					static bool ToSortMode(const std::string& value,
+					                       IndustrialNetwork::POWERLINK::Core::ModularNode::SortMode& result);
+
+				private:
+					/** \brief Gets the slot of a value in a perfect hash table
+					  * \param value 	Value to be looked up
+					  * \param seed 		Seed of the table
+					  * \param slotCount Number of slots of the table
+					  * \return Slot of the value
+					  */
+					static std::size_t GetSlot(const std::string& value,
+					                           const std::uint32_t seed,
+					                           const std::size_t slotCount);
+
+					/** \brief Looks up a value in a perfect hash table
+					  * \param value 	Value to be looked up
+					  * \param table 	Slots of the table
+					  * \param seed 		Seed of the table
+					  * \param result 	Value of the matching slot, unchanged if there is none
+					  * \return true if the value is in the table; false otherwise
+					  */
+					template <typename T, std::size_t N>
+					static bool Find(const std::string& value,
+					                 const EnumEntryType<T> (&table)[N],
+					                 const std::uint32_t seed,
+					                 T& result)
+					{
+						const EnumEntryType<T>& entry = table[GetSlot(value, seed, N)];
+						if ((entry.name == NULL) || (value.compare(entry.name) != 0))
+						{
+							return false;
+						}
+
+						result = entry.value;
+						return true;
+					}
+
+			}; // end of class EnumConverter
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _ENUM_CONVERTER_H_
@@ -0,0 +1,116 @@
+/**
+ * \class GrammarPool
+ *
+ * \brief Process-wide cache of compiled schema grammars shared by all parsers
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#ifndef GRAMMAR_POOL_H_
+#define GRAMMAR_POOL_H_
+
+#include <set>
+#include <mutex>
+
+#include <xercesc/framework/XMLGrammarPool.hpp>
+#include <xercesc/internal/XMLGrammarPoolImpl.hpp>
+
+#include "OpenConfiguratorCli.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			class GrammarPool
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					GrammarPool();
+
+					/** \brief Destructor of the class
+					  */
+					~GrammarPool();
+
+					/** \brief Creates single instance
+					  * \return Static instance of the class
+					  */
+					static GrammarPool& GetInstance();
+
+					/** \brief Compiles the schema file into the pool, once per run
+					  * \param schemaFile		Name of the schema file to be loaded
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult LoadGrammar(const std::string& schemaFile);
+
+					/** \brief Returns the pool to be handed to the DOM parsers
+					  * \return Grammar pool handle
+					  */
+					xercesc::XMLGrammarPool* GetPool();
+
+					/** \brief Locks the pool so that parsers of several threads can share it,
+					  *        no further grammars can be loaded until it is unlocked
+					  * \return Nothing
+					  */
+					void LockPool();
+
+					/** \brief Unlocks the pool, parsers created while it was locked must
+					  *        be released before
+					  * \return Nothing
+					  */
+					void UnlockPool();
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					GrammarPool(const GrammarPool&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					GrammarPool& operator=(const GrammarPool&);
+
+					/** Compiled grammars of all schema files loaded so far */
+					xercesc::XMLGrammarPool* grammarPool;
+
+					/** Absolute paths of the schema files already in the pool */
+					std::set<std::string> loadedSchemaFiles;
+
+					/** True while the pool is shared between threads */
+					bool poolLocked;
+
+					/** Serialises loading of the grammars into the pool */
+					std::mutex poolMutex;
+
+			}; // end of class GrammarPool
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _GRAMMAR_POOL_H_
@@ -0,0 +1,85 @@
+/**
+ * \file NodeAssignmentTable
+ *
+ * \brief Includes the node assignment attributes of the nodes of a project
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#ifndef NODE_ASSIGNMENT_TABLE_H_
+#define NODE_ASSIGNMENT_TABLE_H_
+
+#include <string>
+#include <vector>
+
+#include "CliResult.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			/** Number of POWERLINK node IDs */
+			const std::size_t kNodeIdCount = 256;
+
+			class NodeAssignmentTable
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					NodeAssignmentTable() :
+						result(),
+						firstRow(),
+						rows(kNodeIdCount)
+					{
+					}
+
+					/** \brief Destructor of the class
+					  */
+					~NodeAssignmentTable()
+					{
+					}
+
+					/** Result of the node assignment query */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult result;
+
+					/** Attribute values of the first node of the query in the order of kFormatStrxPathExpression */
+					std::vector<std::string> firstRow;
+
+					/** Attribute values indexed by node ID, empty if the node is not part of the query */
+					std::vector<std::vector<std::string> > rows;
+
+			}; // end of class NodeAssignmentTable
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _NODE_ASSIGNMENT_TABLE_H_
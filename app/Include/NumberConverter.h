@@ -0,0 +1,104 @@
+/**
+ * \class NumberConverter
+ *
+ * \brief Converts numeric attribute values of XDC and XML files without exceptions
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#ifndef NUMBER_CONVERTER_H_
+#define NUMBER_CONVERTER_H_
+
+#include <cstdint>
+#include <string>
+
+#include "CliResult.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			class NumberConverter
+			{
+				public:
+					/** \brief Converts a value to an unsigned 32 bit number
+					  * \param value 	Decimal value, or hexadecimal value with optional "0x" prefix, optionally signed with '+'
+					  * \param base 	10 or 16
+					  * \param result 	Converted number, unchanged if the value is empty
+					  * \return true if the value is empty or a valid number; false otherwise
+					  */
+					static bool ToUInt32(const std::string& value,
+					                     const std::uint8_t base,
+					                     std::uint32_t& result);
+
+					/** \brief Converts a value to an unsigned 8 bit number
+					  * \param value 	Decimal value, or hexadecimal value with optional "0x" prefix, optionally signed with '+'
+					  * \param base 	10 or 16
+					  * \param result 	Lowest 8 bits of the converted number, unchanged if the value is empty
+					  * \return true if the value is empty or a valid number; false otherwise
+					  */
+					static bool ToUInt8(const std::string& value,
+					                    const std::uint8_t base,
+					                    std::uint8_t& result);
+
+					/** \brief Gets the error of a value that could not be converted
+					  * \param value 	Value that could not be converted
+					  * \return CliResult
+					  */
+					static IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult GetConversionError(const std::string& value);
+
+				private:
+					/** \brief Converts a value to an unsigned number within a limit
+					  * \param value 	Value to be converted
+					  * \param base 	10 or 16
+					  * \param maxValue Largest accepted number
+					  * \param result 	Converted number
+					  * \return true if the value is a valid number up to maxValue; false otherwise
+					  */
+					static bool ToNumber(const std::string& value,
+					                     const std::uint8_t base,
+					                     const std::uint64_t maxValue,
+					                     std::uint64_t& result);
+
+					/** \brief Checks for XML white space, the values of the unvalidated
+					  *        parse are not whitespace-collapsed by the schema
+					  * \param character 	Character to be checked
+					  * \return true if the character is XML white space; false otherwise
+					  */
+					static bool IsXmlWhitespace(const char character);
+
+			}; // end of class NumberConverter
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _NUMBER_CONVERTER_H_
@@ -99,9 +99,23 @@ namespace IndustrialNetwork
 			/** Error code XML file from where the error code table gets populate */
 			const std::string kErrorCodeXmlFile = "./resources/error_codes.xml";
 
+			/** Default directory in the working directory recording the files validated by previous runs,
+			    kept out of the output path which only contains generated files */
+			const std::string kValidationCacheDirectory = "./validation_cache";
+
 			/** Maximum number of paramater allowed */
 			const std::uint8_t kMaxNumberOfParameters = 6;
 
+			/**
+			  * Validation applied to the project XML and the XDC files.
+			  */
+			enum class ValidationLevel : std::uint8_t
+			{
+				FULL = 0,	///< Schema validation with full schema constraint checking
+				FAST,		///< Schema validation without full schema constraint checking
+				TRUSTED		///< No validation of files already validated by a previous run
+			};
+
 			class OpenConfiguratorCli
 			{
 				public:
@@ -133,6 +147,18 @@ namespace IndustrialNetwork
 					/** Network name of the project file */
 					std::string networkName;
 
+					/** Number of threads reading and extracting the XDC files */
+					std::uint32_t jobCount;
+
+					/** Validation of the project XML and the XDC files */
+					ValidationLevel validationLevel;
+
+					/** Directory recording the files validated by previous runs */
+					std::string validationCacheDirectory;
+
+					/** Flush the output files to disk before they are renamed into place */
+					bool syncOutputFiles;
+
 				private:
 					/** \brief Prints the command line usage syntax of the application
 					  * \return Nothing
@@ -167,6 +193,36 @@ namespace IndustrialNetwork
 					  */
 					bool IsLogDebug(const std::vector<std::string>& paramsList);
 
+					/** \brief Searches for option '--fsync'
+					  *        from command line parameters list
+					  * \param paramsList		List of command line parameters
+					  * \return true if option is found; false otherwise
+					  */
+					bool IsSyncOutput(const std::vector<std::string>& paramsList);
+
+					/** \brief Searches for options '-j' or '--jobs' followed by
+					  *        the number of jobs from command line parameters list
+					  * \param paramsList		List of command line parameters
+					  * \param jobCountValue	Value given for the option output
+					  * \return true if option is not found or valid; false otherwise
+					  */
+					bool GetJobCount(const std::vector<std::string>& paramsList, std::string& jobCountValue);
+
+					/** \brief Searches for option '--validation-cache' followed by the
+					  *        cache directory from command line parameters list
+					  * \param paramsList		List of command line parameters
+					  * \return true if option is not found or valid; false otherwise
+					  */
+					bool GetValidationCacheDirectory(const std::vector<std::string>& paramsList);
+
+					/** \brief Searches for option '--validate' followed by
+					  *        the validation level from command line parameters list
+					  * \param paramsList		List of command line parameters
+					  * \param levelValue		Value given for the option output
+					  * \return true if option is not found or valid; false otherwise
+					  */
+					bool GetValidationLevel(const std::vector<std::string>& paramsList, std::string& levelValue);
+
 					/** \brief Searches for options '-h' or '--help'
 					  *        from command line parameters list
 					  * \param paramsList		List of command line parameters
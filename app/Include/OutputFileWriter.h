@@ -0,0 +1,216 @@
+/**
+ * \class OutputFileWriter
+ *
+ * \brief Writes the output files on worker threads and renames them into place
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#ifndef OUTPUT_FILE_WRITER_H_
+#define OUTPUT_FILE_WRITER_H_
+
+#include <deque>
+#include <utility>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "OpenConfiguratorCli.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			/**
+			  * Encoding of an output file.
+			  */
+			enum class OutputFileFormat : std::uint8_t
+			{
+				TEXT = 0,	///< Text followed by a line end
+				BINARY,		///< Binary data written unchanged
+				HEX_TEXT	///< Binary data written as comma separated hex bytes, 16 per line
+			};
+
+			/**
+			  * Content of an output file waiting to be written.
+			  */
+			class OutputFile
+			{
+				public:
+					/** \brief Constructor of the class
+					  * \param targetPath 	Final path of the file
+					  * \param format 		Encoding of the file
+					  */
+					OutputFile(const std::string& targetPath, const OutputFileFormat format);
+
+					/** \brief Destructor of the class
+					  */
+					~OutputFile();
+
+					/** Final path of the file */
+					std::string targetPath;
+
+					/** Encoding of the file */
+					OutputFileFormat format;
+
+					/** Content of a TEXT file */
+					std::string text;
+
+					/** Content of a BINARY or HEX_TEXT file, shared between the files of the same data */
+					std::shared_ptr<const std::vector<std::uint8_t> > binary;
+			};
+
+			/**
+			  * Each file is written to a temporary file next to its target. The
+			  * temporary files are renamed over their targets only after all files
+			  * of the run are complete, so that a failed run leaves the previous
+			  * outputs in place.
+			  */
+			class OutputFileWriter
+			{
+				public:
+					/** \brief Constructor of the class
+					  * \param syncFiles 	Flushes each file to disk before it is renamed if true
+					  */
+					explicit OutputFileWriter(bool syncFiles);
+
+					/** \brief Destructor of the class, discards the files not yet committed
+					  */
+					~OutputFileWriter();
+
+					/** \brief Starts the worker threads
+					  * \param threadCount 	Number of worker threads
+					  * \return Nothing
+					  */
+					void Start(std::uint32_t threadCount);
+
+					/** \brief Queues a file to be written, its content is taken over
+					  * \param file 		File to be written, its content is empty afterwards
+					  * \return Nothing
+					  */
+					void Add(OutputFile& file);
+
+					/** \brief Writes the remaining files and stops the worker threads
+					  * \param commit 	Renames the files over their targets if true and all
+					  *               	files were written, removes the temporary files otherwise
+					  * \return CliResult of the first file which could not be written or renamed
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult Finish(bool commit);
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					OutputFileWriter(const OutputFileWriter&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					OutputFileWriter& operator=(const OutputFileWriter&);
+
+					/** \brief Writes queued files until the writer is finished
+					  * \return Nothing
+					  */
+					void Worker();
+
+					/** \brief Takes the next queued file
+					  * \param wait 		Waits for a file until the writer is finished if true
+					  * \param file 		Next file output
+					  * \return true if a file was taken; false otherwise
+					  */
+					bool TakeFile(bool wait, std::unique_ptr<OutputFile>& file);
+
+					/** \brief Writes a file to a unique temporary path next to its target
+					  * \param file 		File to be written
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult WriteFile(const OutputFile& file);
+
+					/** \brief Renames the written files over their targets
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CommitFiles();
+
+					/** \brief Removes the temporary files not renamed so far
+					  * \return Nothing
+					  */
+					void DiscardFiles();
+
+					/** \brief Writes the content of a file in its encoding
+					  * \param file 		File to be written
+					  * \param stream 		Opened output stream
+					  * \return Nothing
+					  */
+					static void WriteContent(const OutputFile& file, std::ofstream& stream);
+
+					/** \brief Flushes a file or directory to disk
+					  * \param path 		Path of the file or directory
+					  * \param isDirectory 	True for a directory
+					  * \return true if flushed; false otherwise
+					  */
+					static bool SyncPath(const std::string& path, bool isDirectory);
+
+					/** \brief Stores the result of a written file
+					  * \param result 		Result of the file
+					  * \return Nothing
+					  */
+					void SetResult(const IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult& result);
+
+					/** Files waiting to be written */
+					std::deque<std::unique_ptr<OutputFile> > pendingFiles;
+
+					/** Temporary and target path of the written files, in write order */
+					std::vector<std::pair<std::string, std::string> > writtenFiles;
+
+					/** Flush each file to disk before it is renamed */
+					bool syncFiles;
+
+					/** True once no more files are added */
+					bool finished;
+
+					/** First file which could not be written */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult failure;
+
+					/** True if a file could not be written */
+					bool hasFailure;
+
+					/** Worker threads */
+					std::vector<std::thread> workers;
+
+					/** Serialises access to the queue and the result */
+					std::mutex writerMutex;
+
+					/** Signals queued files and the end of the queue */
+					std::condition_variable fileQueued;
+
+			}; // end of class OutputFileWriter
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _OUTPUT_FILE_WRITER_H_
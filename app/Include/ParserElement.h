@@ -38,7 +38,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "OpenConfiguratorCli.h"
 #include "ParserErrorHandler.h"
+#include "ParserPool.h"
 #include <xercesc/sax/SAXParseException.hpp>
+#include <map>
 
 namespace IndustrialNetwork
 {
@@ -53,8 +55,10 @@ namespace IndustrialNetwork
 					/** \brief Constructor of the class with file
 					  * \param file			Name of XML ot XDC file to parse
 					  * \param schemaFile	Name of the schema file for validation
+					  * \param xmlNamespace	Namespace of the schema file
+					  * \param pruneUnusedElements	Drops the subtrees of XDC files that are never imported
 					  */
-					ParserElement(const std::string& file, const std::string& schemaFile, const std::string& xmlNamespace);
+					ParserElement(const std::string& file, const std::string& schemaFile, const std::string& xmlNamespace, bool pruneUnusedElements);
 
 					/** \brief Destructor of the class
 					  */
@@ -65,6 +69,19 @@ namespace IndustrialNetwork
 					  */
 					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateElement();
 
+					/** \brief Creates element for parsing without validating against
+					  *        the schema, the schema attribute defaults are still applied
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateUnvalidatedElement();
+
+					/** \brief Gets the compiled XPath expression of the document,
+					  *        each expression is compiled on its first request only
+					  * \param xPathExpression	XPath expression to be compiled
+					  * \return Compiled expression owned by the element
+					  */
+					const xercesc::DOMXPathExpression* GetXPathExpression(const std::string& xPathExpression) const;
+
 					/** Document handle */
 					xercesc::DOMDocument* domDocument;
 
@@ -81,10 +98,17 @@ namespace IndustrialNetwork
 					/** \brief private copy assign, no definition (declaration-only) */
 					ParserElement& operator=(const ParserElement&);
 
+					/** \brief Parses the file and stores the document handles
+					  * \param validateSchema	Validates against the schema file if true
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult BuildElement(bool validateSchema);
+
 					/** \brief Validates against schema file and parses
+					  * \param validateSchema	Validates against the schema file if true
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult parseFile();
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult parseFile(bool validateSchema);
 
 					/** file that has to be parsed */
 					std::string filePath;
@@ -95,6 +119,15 @@ namespace IndustrialNetwork
 					/** namespace for validation */
 					std::string xmlNamespace;
 
+					/** Parser taken from the pool, returned with the element */
+					PooledParser* pooledParser;
+
+					/** Bytes allocated by the parser before this document */
+					std::uint64_t allocatedBytesBefore;
+
+					/** Compiled XPath expressions of the document keyed by expression */
+					mutable std::map<std::string, xercesc::DOMXPathExpression*> xPathExpressionCache;
+
 			}; // end of class ParserElement
 		} // end of namespace Application
 	} // end of namespace POWERLINK
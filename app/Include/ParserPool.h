@@ -0,0 +1,141 @@
+/**
+ * \class ParserPool
+ *
+ * \brief Pool of configured DOM parsers which are reused across files
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#ifndef PARSER_POOL_H_
+#define PARSER_POOL_H_
+
+#include <vector>
+#include <mutex>
+
+#include <xercesc/parsers/XercesDOMParser.hpp>
+
+#include "ArenaMemoryManager.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			/**
+			  * DOM parser together with the arena its documents are allocated from.
+			  * The parser itself uses the default memory manager and is kept across
+			  * documents.
+			  */
+			class PooledParser
+			{
+				public:
+					/** \brief Constructor of the class, creates and configures the parser
+					  * \param pruneUnusedElements	Drops the subtrees of XDC files that are never imported
+					  */
+					explicit PooledParser(bool pruneUnusedElements);
+
+					/** \brief Destructor of the class
+					  */
+					~PooledParser();
+
+					/** Arena of the documents, declared before the parser */
+					ArenaMemoryManager memory;
+
+					/** DOM parser handle */
+					xercesc::XercesDOMParser* parser;
+
+					/** unused subtrees are not built into the document */
+					bool pruneUnusedElements;
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					PooledParser(const PooledParser&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					PooledParser& operator=(const PooledParser&);
+			};
+
+			/**
+			  * Parsers created while the grammar pool is locked use its synchronized
+			  * string pool. The idle parsers have to be cleared whenever the grammar
+			  * pool is locked or unlocked.
+			  */
+			class ParserPool
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					ParserPool();
+
+					/** \brief Destructor of the class
+					  */
+					~ParserPool();
+
+					/** \brief Creates single instance
+					  * \return Static instance of the class
+					  */
+					static ParserPool& GetInstance();
+
+					/** \brief Takes an idle parser of the requested kind or creates a new one
+					  * \param pruneUnusedElements	Drops the subtrees of XDC files that are never imported
+					  * \return Parser owned by the caller until it is released
+					  */
+					PooledParser* Acquire(bool pruneUnusedElements);
+
+					/** \brief Releases the documents, rewinds the arena and keeps the parser for reuse
+					  * \param pooledParser	Parser taken from the pool
+					  * \return Nothing
+					  */
+					void Release(PooledParser* pooledParser);
+
+					/** \brief Deletes all idle parsers
+					  * \return Nothing
+					  */
+					void Clear();
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					ParserPool(const ParserPool&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					ParserPool& operator=(const ParserPool&);
+
+					/** Parsers ready to be reused */
+					std::vector<PooledParser*> idleParsers;
+
+					/** Serialises access to the idle parsers */
+					std::mutex poolMutex;
+
+			}; // end of class ParserPool
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _PARSER_POOL_H_
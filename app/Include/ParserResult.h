@@ -38,6 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "OpenConfiguratorCli.h"
 #include "ParserElement.h"
+#include "ParserResultTable.h"
 
 namespace IndustrialNetwork
 {
@@ -79,8 +80,8 @@ namespace IndustrialNetwork
 					        const std::string& formatString,
 					        const xercesc::DOMNode* parentNode);
 
-					/** Parsed parameters */
-					std::vector<std::vector<std::string> > parameters;
+					/** Parsed parameters, equal values are stored once per result */
+					ParserResultTable parameters;
 
 					/** Parent node */
 					xercesc::DOMNode* resultNodeValue;
@@ -88,6 +89,24 @@ namespace IndustrialNetwork
 					/** Parsed node */
 					std::vector<xercesc::DOMNode*> node;
 
+					/** \brief Converts the attribute names of a format string to XMLCh,
+					  *        once per query instead of once per node
+					  * \param formatString 	Attribute names as string separated by comma
+					  * \return Attribute names in the order of the format string
+					  */
+					static std::vector<std::basic_string<XMLCh> > GetAttributeNames(const std::string& formatString);
+
+					/** \brief Gets the values of the requested attributes of a node,
+					  *        missing attributes are returned as empty values
+					  * \param domNode 			Instance of DOMNode
+					  * \param attributeNames 	Attribute names from GetAttributeNames
+					  * \param attributeValues 	Attribute values output
+					  * \return true if the node is an element with attributes; false otherwise
+					  */
+					static bool GetAttributeValues(const xercesc::DOMNode* domNode,
+					                               const std::vector<std::basic_string<XMLCh> >& attributeNames,
+					                               std::vector<std::string>& attributeValues);
+
 				private:
 					/** \brief private copy constructor, no definition (declaration-only) */
 					ParserResult(const ParserResult&);
@@ -95,14 +114,6 @@ namespace IndustrialNetwork
 					/** \brief private copy assign, no definition (declaration-only) */
 					ParserResult& operator=(const ParserResult&);
 
-					/** \brief Gets the value of attribute available
-					  * \param domNode 			Instance of DOMNode
-					  * \param attributeName 	Name of the attribute
-					  * \return Attribute value
-					  */
-					void ParseAttributeValues(const xercesc::DOMNode* domNode,
-					                          const std::vector<std::string>& attributeName);
-
 			}; // end of class ParserResult
 		} // end of namespace Application
 	} // end of namespace POWERLINK
@@ -0,0 +1,146 @@
+/**
+ * \class ParserResultTable
+ *
+ * \brief Stores the attribute rows of a parser result in flat storage
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#ifndef PARSER_RESULT_TABLE_H_
+#define PARSER_RESULT_TABLE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <unordered_set>
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			class ParserResultTable
+			{
+				public:
+					/** \brief Read-only view of one row of the table
+					  */
+					class Row
+					{
+						public:
+							/** \brief Constructor of the class
+							  * \param table 		Table that owns the row
+							  * \param firstCell 	Index of the first cell of the row
+							  * \param cellCount 	Number of cells of the row
+							  */
+							Row(const ParserResultTable& table,
+							    std::size_t firstCell,
+							    std::size_t cellCount);
+
+							/** \brief Gets a cell of the row
+							  * \param column 	Column of the cell
+							  * \return Value of the cell, owned by the table
+							  * \throws std::out_of_range if the column does not exist
+							  */
+							const std::string& at(std::size_t column) const;
+
+							/** \brief Gets the number of cells of the row
+							  * \return Number of cells
+							  */
+							std::size_t size() const;
+
+						private:
+							/** Table that owns the row */
+							const ParserResultTable& table;
+
+							/** Index of the first cell of the row */
+							std::size_t firstCell;
+
+							/** Number of cells of the row */
+							std::size_t cellCount;
+					};
+
+					/** \brief Default constructor of the class
+					  */
+					ParserResultTable();
+
+					/** \brief Destructor of the class
+					  */
+					~ParserResultTable();
+
+					/** \brief Appends a row, equal values share one string
+					  * \param rowValues 	Cell values of the row
+					  */
+					void AddRow(const std::vector<std::string>& rowValues);
+
+					/** \brief Gets a row of the table
+					  * \param row 	Index of the row
+					  * \return View of the row, valid as long as the table
+					  */
+					Row operator[](std::size_t row) const;
+
+					/** \brief Gets the number of rows
+					  * \return Number of rows
+					  */
+					std::size_t size() const;
+
+					/** \brief Checks whether the table has no rows
+					  * \return true if the table is empty; false otherwise
+					  */
+					bool empty() const;
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					ParserResultTable(const ParserResultTable&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					ParserResultTable& operator=(const ParserResultTable&);
+
+					/** \brief Gets the shared copy of a value
+					  * \param value 	Value to be looked up
+					  * \return Pointer to the stored value
+					  */
+					const std::string* InternValue(const std::string& value);
+
+					/** Distinct cell values, nodes keep their address when the set grows */
+					std::unordered_set<std::string> values;
+
+					/** Cells of all rows, row after row */
+					std::vector<const std::string*> cells;
+
+					/** Index of the first cell of each row */
+					std::vector<std::size_t> rowOffsets;
+
+			}; // end of class ParserResultTable
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _PARSER_RESULT_TABLE_H_
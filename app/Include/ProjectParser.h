@@ -39,7 +39,20 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "OpenConfiguratorCli.h"
 #include "ParserElement.h"
 #include "ParserResult.h"
+#include "DeviceTemplate.h"
+#include "NumberConverter.h"
+#include "NodeAssignmentTable.h"
+#include "BackgroundValidator.h"
 #include <map>
+#include <set>
+#include <unordered_set>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
 
 namespace IndustrialNetwork
 {
@@ -97,8 +110,7 @@ namespace IndustrialNetwork
 					/** \brief Updates the XDC node information into core library
 					  * \param nodeId 			Node ID value of node
 					  * \param pathXdc 			XDC path of node
-					  * \param forcedObject 	Vector of forced objects in node
-					  * \param forcedSubObject 	Vector of forced sub-objects in node
+					  * \param forcedObjects 	Keys of the forced sub-objects of node
 					  * \param interfceId 		Inteface ID of modular node
 					  * \param modId 			ID of module
 					  * \param modPosition 		Position of module
@@ -106,8 +118,7 @@ namespace IndustrialNetwork
 					  */
 					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult UpdateNodeIdCollection(const std::uint8_t nodeId,
 					        const std::string& pathXdc,
-					        const std::vector<std::string>& forcedObject,
-					        const std::vector<std::string>& forcedSubObject,
+					        const std::unordered_set<std::uint64_t>& forcedObjects,
 					        const std::string& interfceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
@@ -125,14 +136,14 @@ namespace IndustrialNetwork
 
 					/** \brief Updates the Device POWERLINK profile body of
 					  *        XDD/XDC into core library
-					  * \param element 		Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 		ID value of node
 					  * \param interfceId 	Inteface ID of modular node
 					  * \param modId 		ID of module
 					  * \param modPosition 	Position of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult ImportProfileBodyDevice(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult ImportProfileBodyDevice(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId,
 					        const std::string& interfaceId,
 					        const std::string& modId,
@@ -140,61 +151,52 @@ namespace IndustrialNetwork
 
 					/** \brief Updates the Communication POWERLINK profile body
 					  *        of XDD/XDC into core library
-					  * \param element 			Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 			ID value of node
-					  * \param forcedObject 	Vector of forced objects in node
-					  * \param forcedSubObject 	Vector of forced sub-objects in node
+					  * \param forcedObjects 	Keys of the forced sub-objects of node
 					  * \param interfceID 		Inteface ID of modular node
 					  * \param modId 			ID of module
 					  * \param modPosition 		Position of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult ImportProfileBodyCommn(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult ImportProfileBodyCommn(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId,
-					        const std::vector<std::string>& forcedObject,
-					        const std::vector<std::string>& forcedSubObject,
+					        const std::unordered_set<std::uint64_t>& forcedObjects,
 					        const std::string& interfaceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
 
 					/**
 					  * \brief Updates the Dynamic channels of XDD/XDC into core library
-					  * \param element 			Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 			ID value of node
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateDynamicChannels(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateDynamicChannels(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId);
 
-					/**
-					  * \brief Gets the access type of dynamic channel
-					  * \param accessType 			Access type of dynamic channels
-					  * \return DynamicChannelAccessType
-					  */
-					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::DynamicChannelAccessType GetDynamicChannelAccessType(const std::string& accessType);
-
 					/** \brief Creates network management general features
-					  * \param element 		Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 		ID value of node
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateNwMgtGeneralFeatures(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateNwMgtGeneralFeatures(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId);
 
 					/** \brief Creates network management MN features
-					  * \param element 		Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 		ID value of node
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateNwMgtMnFeatures(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateNwMgtMnFeatures(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId);
 
 					/** \brief Creates network management CN features
-					  * \param element 		Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 		ID value of node
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateNwMgtCnFeatures(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateNwMgtCnFeatures(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId);
 
 					/** \brief Creates node assignment values of node
@@ -207,6 +209,15 @@ namespace IndustrialNetwork
 					        const std::string& xPathExpression,
 					        const std::uint8_t nodeId);
 
+					/** \brief Gets the node assignment attributes of all nodes of a query,
+					  *        the query is evaluated on first use in a run
+					  * \param element 			Element that contains handle of XML
+					  * \param xPathExpression 	xpath expression of XML
+					  * \return Node assignment attributes indexed by node ID
+					  */
+					const NodeAssignmentTable& GetNodeAssignmentTable(const ParserElement& element,
+					        const std::string& xPathExpression);
+
 					/** \brief Sets node assignment values of node into library
 					  * \param nodeassign 		Node assignment attribute
 					  * \param nodeId 			ID value of node
@@ -218,205 +229,166 @@ namespace IndustrialNetwork
 					        const std::string& value);
 
 					/** \brief Creates Struct and Array data type parse results
-					  * \param element 		Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 		ID value of node
 					  * \param interfaceId 	Inteface ID of module node
 					  * \param modId 		ID value of module
 					  * \param modPosition 	Position value of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateDataType(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateDataType(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId,
 					        const std::string& interfaceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
 
 					/** \brief Creates Struct data type parse results
-					  * \param element 		Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 		ID value of node
 					  * \param interfaceId	Inteface ID of module node
 					  * \param modId 		ID value of module
 					  * \param modPosition 	Position value of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateStructDataType(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateStructDataType(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId,
 					        const std::string& interfaceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
 
 					/** \brief Creates Array data type parse results
-					  * \param element 		Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 		ID value of node
 					  * \param interfaceId 	Inteface ID of module node
 					  * \param modId 		ID value of module
 					  * \param modPosition 	Position value of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateArrayDataType(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateArrayDataType(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId,
 					        const std::string& interfaceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
 
 					/** \brief Creates parameter template related parse results
-					  * \param element 		Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 		Specifies the Id value of node
 					  * \param interfaceId 	Inteface ID of module node
 					  * \param modId 		ID value of module
 					  * \param modPosition 	Position value of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateParameterTemplate(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateParameterTemplate(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId,
 					        const std::string& interfaceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
 
 					/** \brief Creates parameter group related parse results
-					  * \param element 		Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 		ID value of node
 					  * \param interfaceId 	Inteface ID of module node
 					  * \param modId 		ID value of module
 					  * \param modPosition 	Position value of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateParameterGroup(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateParameterGroup(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId,
 					        const std::string& interfaceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
 
 					/** \brief Creates parameter list related parse results
-					  * \param element 		Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 		ID value of node
 					  * \param interfaceId 	Inteface ID of module node
 					  * \param modId 		ID value of module
 					  * \param modPosition 	Position value of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateParameterList(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateParameterList(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId,
 					        const std::string& interfaceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
 
-					/** \brief Creates child parameter group related parse results
-					  * \param element 				Element that contains handle of XDC
-					  * \param nodeId 				ID value of node
-					  * \param parameterGroupNode	Parent parameter group node
-					  * \param paramGroupUId 		Parent parameter group node ID
-					  * \param interfaceId 			Inteface ID of module node
-					  * \param modId 				ID value of module
-					  * \param modPosition 			Position value of module
+					/** \brief Creates object related parse results and set parameters
+					  * \param deviceTemplate	Device template extracted from XDC
+					  * \param nodeId 			ID value of node
+					  * \param forcedObjects 	Keys of the forced sub-objects of node
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateChildParameterGroup(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateObject(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId,
-					        const xercesc::DOMNode* parameterGroupNode,
-					        const std::string& paramGroupUId,
-					        const std::string& interfaceId,
-					        const std::string& modId,
-					        const std::uint32_t modPosition);
+					        const std::unordered_set<std::uint64_t>& forcedObjects);
 
-					/** \brief Creates object related parse results and set parameters
-					  * \param element 			Element that contains handle of XDC
-					  * \param nodeId 			ID value of node
-					  * \param forcedObject 	Vector of forced objects in node
-					  * \param forcedSubObject 	Vector of forced sub-objects in node
+					/** \brief Checks that a uniqueID reference resolves to a parameter of the XDC
+					  * \param deviceTemplate	Device template extracted from XDC
+					  * \param uniqueIdRef 		Referenced uniqueID
+					  * \param isTemplate 		Checks for a parameter template if true
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateObject(const ParserElement& element,
-					        const std::uint8_t nodeId,
-					        const std::vector<std::string>& forcedObject,
-					        const std::vector<std::string>& forcedSubObject);
+					static IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CheckParameterRef(const DeviceTemplate& deviceTemplate,
+					        const std::string& uniqueIdRef,
+					        const bool isTemplate);
 
-					/** \brief Sets allowed values
-					  * \param element 		Element that contains handle of XDC
+					/** \brief Sets allowed, default and actual values of a parameter or parameter template
+					  * \param parameter 	Parameter extracted from XDC
 					  * \param nodeId 		ID value of node
 					  * \param interfaceId 	Inteface ID of module node
 					  * \param modId 		ID value of module
 					  * \param modPosition 	Position value of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult SetParamAllowedValue(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult SetParamValues(const XdcParameterType& parameter,
 					        const std::uint8_t nodeId,
-					        const xercesc::DOMNode* node,
-					        const std::string& uniqueId,
 					        const std::string& interfaceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
 
+					/** \brief Sets allowed values
+					  * \param parameter 	Parameter extracted from XDC
+					  * \param nodeId 		ID value of node
+					  * \param parameterId 	ID value of the parameter in the core library
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult SetParamAllowedValue(const XdcParameterType& parameter,
+					        const std::uint8_t nodeId,
+					        const std::string& parameterId);
+
 					/** \brief Sets allowed range values
-					  * \param element 		Element that contains handle of XDC
+					  * \param parameter 	Parameter extracted from XDC
 					  * \param nodeId 		ID value of node
-					  * \param interfaceId 	Inteface ID of module node
-					  * \param modId 		ID value of module
-					  * \param modPosition 	Position value of module
+					  * \param parameterId 	ID value of the parameter in the core library
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult SetParamAllowedRange(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult SetParamAllowedRange(const XdcParameterType& parameter,
 					        const std::uint8_t nodeId,
-					        const xercesc::DOMNode* node,
-					        const std::string& uniqueId,
-					        const std::string& interfaceId,
-					        const std::string& modId,
-					        const std::uint32_t modPosition);
+					        const std::string& parameterId);
 
 					/** \brief Sets actual values
-					  * \param element 		Element that contains handle of XDC
+					  * \param parameter 	Parameter extracted from XDC
 					  * \param nodeId 		ID value of node
-					  * \param interfaceId 	Inteface ID of module node
-					  * \param modId 		ID value of module
-					  * \param modPosition 	Position value of module
+					  * \param parameterId 	ID value of the parameter in the core library
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult SetParamActualValue(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult SetParamActualValue(const XdcParameterType& parameter,
 					        const std::uint8_t nodeId,
-					        const xercesc::DOMNode* node,
-					        const std::string& uniqueId,
-					        const std::string& interfaceId,
-					        const std::string& modId,
-					        const std::uint32_t modPosition);
+					        const std::string& parameterId);
 
 					/** \brief Sets dafault values
-					  * \param element 		Element that contains handle of XDC
+					  * \param parameter 	Parameter extracted from XDC
 					  * \param nodeId 		ID value of node
-					  * \param interfaceId 	Inteface ID of module node
-					  * \param modId 		ID value of module
-					  * \param modPosition 	Position value of module
+					  * \param parameterId 	ID value of the parameter in the core library
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult SetParamDefaultValue(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult SetParamDefaultValue(const XdcParameterType& parameter,
 					        const std::uint8_t nodeId,
-					        const xercesc::DOMNode* node,
-					        const std::string& uniqueId,
-					        const std::string& interfaceId,
-					        const std::string& modId,
-					        const std::uint32_t modPosition);
-
-					/** \brief Gets the addressing value of modular device from the XDC
-					  * \param modAddressing 	Module addressing value in XDC
-					  * \return ModuleAddressing
-					  */
-					IndustrialNetwork::POWERLINK::Core::ModularNode::ModuleAddressing GetModuleAddressing(const std::string& modAddressing);
-
-					/** \brief Gets the sort number of modular device from the XDC
-					  * \param sortNumber 		Sort number value in XDC
-					  * \return SortNumber
-					  */
-					IndustrialNetwork::POWERLINK::Core::ModularNode::SortNumber GetSortNumber(const std::string& sortNumber);
-
-					/** \brief Gets the sort mode of modular device from the XDC
-					  * \param sortMode 		Sort mode value in XDC
-					  * \return SortMode
-					  */
-					IndustrialNetwork::POWERLINK::Core::ModularNode::SortMode GetSortMode(const std::string& sortMode);
+					        const std::string& parameterId);
 
 					/** \brief Creates module of node into library
 					  * \param nodeId 			ID value of node
-					  * \param forcedObject 	Forced objects vector of node
-					  * \param forcedSubObject 	Forced sub-objects vector of node
+					  * \param forcedObjects 	Keys of the forced sub-objects of node
 					  * \param interfaceId 		Interface ID value of modular node
 					  * \param moduleName 		Name of module
 					  * \param modulePosition 	Position value of module
@@ -426,8 +398,7 @@ namespace IndustrialNetwork
 					  * \return CliResult
 					  */
 					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateModule(const std::uint8_t nodeId,
-					        const std::vector<std::string>& forcedObject,
-					        const std::vector<std::string>& forcedSubObject,
+					        const std::unordered_set<std::uint64_t>& forcedObjects,
 					        const std::string& interfaceId,
 					        const std::string& moduleName,
 					        const std::string& modulePosition,
@@ -436,19 +407,17 @@ namespace IndustrialNetwork
 					        const std::uint8_t maxModulePosition);
 
 					/** \brief Creates the object list of modules from XDC into core library
-					  * \param element 			Element that contains handle of XDC
+					  * \param deviceTemplate	Device template extracted from XDC
 					  * \param nodeId 			ID value of node
-					  * \param forcedObject 	Forced objects vector of node
-					  * \param forcedSubObject 	Forced sub-objects vector of node
+					  * \param forcedObjects 	Keys of the forced sub-objects of node
 					  * \param interfaceId 		Inteface ID of modular node
 					  * \param modId 			ID value of module
 					  * \param modPosition 		Position value of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateModuleObject(const ParserElement& element,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateModuleObject(const DeviceTemplate& deviceTemplate,
 					        const std::uint8_t nodeId,
-					        const std::vector<std::string>& forcedObject,
-					        const std::vector<std::string>& forcedSubObject,
+					        const std::unordered_set<std::uint64_t>& forcedObjects,
 					        const std::string& interfaceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
@@ -504,26 +473,28 @@ namespace IndustrialNetwork
 					/** \brief Updates the forced object list of node
 					  * \param element 			Element that contains handle of XDC
 					  * \param xPathExpression 	Xpath expression of forced objects in XML
-					  * \param forcedObject 	Forced objects vector output of node
-					  * \param forcedSubObject 	Forced sub-objects vector output of node
+					  * \param forcedObjects 	Keys of the forced sub-objects output of node
 					  * \param parentNode		Parent node ID value
 					  * \return CliResult
 					  */
 					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CreateForcedObjects(const ParserElement& pElement,
 					        const std::string& xPathExpression,
-					        std::vector<std::string>& forcedObject,
-					        std::vector<std::string>& forcedSubObject,
+					        std::unordered_set<std::uint64_t>& forcedObjects,
 					        const xercesc::DOMNode* parentNode);
 
+					/** \brief Gets the key of a sub-object in a forced object set
+					  * \param objectId 		Index of object
+					  * \param subObjectId 	Sub-index of sub-object
+					  * \return Key of the sub-object
+					  */
+					static std::uint64_t GetForcedObjectKey(const std::uint32_t objectId,
+					                                        const std::uint8_t subObjectId);
+
 					/** \brief Updates the forced object list of node into core library
-					  * \param forcedObject 		Forced objects vector of node
-					  * \param forcedSubObject 		Forced sub-objects vector of node
+					  * \param forcedObjects 		Keys of the forced sub-objects of node
 					  * \param nodeId 				ID value of node
-					  * \param objectIndex 			Index value of object
-					  * \param SubobjectIndex 		Sub-index value of sub-object
 					  * \param objectId 			ID value of object
 					  * \param subObjectId 			ID value of sub-object
-					  * \param objectActualValue 	Actual value of object
 					  * \param subobjectActualValue Actual value of sub-object
 					  * \param moduleCheck 			Checks module or node
 					  * \param interfaceId 			Inteface ID  of modular node
@@ -531,68 +502,159 @@ namespace IndustrialNetwork
 					  * \param modPosition 			Position value of module
 					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult UpdateForcedObjects(const std::vector<std::string>& forcedObject,
-					        const std::vector<std::string>& forcedSubObject,
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult UpdateForcedObjects(const std::unordered_set<std::uint64_t>& forcedObjects,
 					        const std::uint8_t nodeId,
-					        const std::string& objectIndex,
-					        const std::string& SubobjectIndex,
 					        const std::uint32_t objectId,
 					        const std::uint8_t subObjectId,
-					        const std::string& objectActualValue,
 					        const std::string& subobjectActualValue,
 					        const bool moduleCheck,
 					        const std::string& interfaceId,
 					        const std::string& modId,
 					        const std::uint32_t modPosition);
 
+					/** \brief Resolves the XDC path of a node relative to the project file
+					  * \param xdcFile 		XDC path as given in the project file
+					  * \return Resolved XDC path
+					  */
+					std::string GetXdcPath(const std::string& xdcFile);
+
+					/** \brief Gets the device template of an XDC, nodes with identical
+					  *        XDC content share one template within a run
+					  * \param xdcFile 			XDC path as given in the project file
+					  * \param deviceTemplate 	Device template extracted from XDC output
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult GetDeviceTemplate(const std::string& xdcFile,
+					        std::shared_ptr<const DeviceTemplate>& deviceTemplate);
+
+					/** \brief Gets the content key of an XDC, the file is hashed only
+					  *        on its first request in a run
+					  * \param xdcPath 		Resolved XDC path
+					  * \param contentKey 	Hash and size of the XDC content output
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult GetXdcContentKey(const std::string& xdcPath,
+					        std::string& contentKey);
+
+					/** \brief Reads and extracts the device template of an XDC, validated
+					  *        in the same parse unless it is validated in the background
+					  * \param xdcPath 			Resolved XDC path
+					  * \param deviceTemplate 	Device template extracted from XDC output
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult ExtractDeviceTemplate(const std::string& xdcPath,
+					        std::shared_ptr<const DeviceTemplate>& deviceTemplate);
+
+					/** \brief Creates the result of an extraction that failed with an
+					  *        exception not derived from std::exception
+					  * \param xdcPath 			Resolved XDC path
+					  * \return CliResult
+					  */
+					static IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult GetExtractionFailure(const std::string& xdcPath);
 
-					std::map<std::string, IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype> iecdataTypeMap;
-					std::map<std::string, IndustrialNetwork::POWERLINK::Core::ObjectDictionary::ParameterAccess> parameterAccessMap;
-					std::map<std::string, IndustrialNetwork::POWERLINK::Core::ObjectDictionary::AccessType> accessTypeMap;
-					std::map<std::string, IndustrialNetwork::POWERLINK::Core::ObjectDictionary::PDOMapping> pdoMappingMap;
+					/** \brief Imports the project configuration and all nodes
+					  * \param element 		Element that contains handle of XML
+					  * \param xdcPaths 		Resolved XDC paths of the project, largest files first
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult ImportProject(const ParserElement& element,
+					        const std::vector<std::string>& xdcPaths);
 
-					/** \brief Gets the IEC_Datatype based on the string retrieved from XDC
-					  * \param dataType Specifies the dataType value of object or parameter
-					  * \return IEC_Datatype
+					/** \brief Collects the distinct valid XDC paths of all nodes and modules
+					  * \param element 		Element that contains handle of XML
+					  * \param xdcPaths 		Resolved XDC paths, largest files first output
+					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype GetDataType(const std::string& dataType);
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CollectXdcPaths(const ParserElement& element,
+					        std::vector<std::string>& xdcPaths);
 
-					/** \brief Gets the ParameterAccess based on the value retrieved from XDC
-					  * \param access 		The access value of parameter
-					  * \return ParameterAccess
+					/** \brief Locks the grammar pool and starts validating the project
+					  *        file and the XDCs in the background
+					  * \param xmlPath 		Project XML file
+					  * \param xdcPaths 		Resolved XDC paths of the project
+					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::ParameterAccess GetParameterAccess(const std::string& access);
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult StartValidation(const std::string& xmlPath,
+					        const std::vector<std::string>& xdcPaths);
 
-					/** \brief Gets the ObjectType of object from XDC
-					  * \param objType 		Specifies the type of an object
-					  * \return ObjectType
-					 */
-					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::ObjectType GetObjectType(const std::uint8_t objType);
+					/** \brief Waits for the validation of the project file, stops the
+					  *        background validation and unlocks the grammar pool
+					  * \param xmlPath 		Project XML file
+					  * \return CliResult of the project file validation
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult StopValidation(const std::string& xmlPath);
 
-					/** \brief Gets the PlkDataType of object from XDC
-					  * \param plkDataType 	Specifies the data type of an object
-					  * \return PlkDataType
+					/** \brief Starts extracting the device templates of all XDCs of the project
+					  *        on the configured number of jobs, the import picks up each
+					  *        template in node order as soon as it is extracted
+					  * \param xdcPaths 		Resolved XDC paths, largest files first
+					  * \return CliResult
 					  */
-					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::PlkDataType GetPlkDataType(const std::string& plkDataType);
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult PrefetchDeviceTemplates(const std::vector<std::string>& xdcPaths);
 
-					/** \brief Gets the AccessType of object from XDC
-					  * \param accessType 	Specifies the access type of object
-					  * \return AccessType
+					/** \brief Stops the prefetch workers once their current file is extracted
+					  * \return Nothing
 					  */
-					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::AccessType GetObjAccessType(const std::string& accessType);
+					void StopPrefetch();
 
-					/** \brief Gets the PDOMapping of object or sub-object from XDC
-					  * \param pdoMapp Specifies the mapping value of object or sub-object
-					  * \return PDOMapping
+					/** \brief Extracts device templates until all XDC paths are taken
+					  *        or the prefetch is stopped
+					  * \return Nothing
 					  */
-					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::PDOMapping GetPdoMapping(const std::string& pdoMapp);
+					void PrefetchWorker();
 
-					/** \brief Gets the IEC_Datatype of object or sub-object
-					  *        based on element in XDC
-					  * \param node 		Instance of DOMNode
-					  * \return IEC_Datatype
+					/** \brief Stores the extraction result of a claimed content key and
+					  *        wakes the import waiting for it
+					  * \param contentKey 		Content key of the XDC
+					  * \param xdcTemplate 	Extracted device template, empty on failure
+					  * \param result 			Result of the extraction
+					  * \return Nothing
 					  */
-					IndustrialNetwork::POWERLINK::Core::ObjectDictionary::IEC_Datatype GetIecDataType(const xercesc::DOMNode* node);
+					void CompleteDeviceTemplate(const std::string& contentKey,
+					                            const std::shared_ptr<const DeviceTemplate>& xdcTemplate,
+					                            const IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult& result);
+
+					/** Content keys of the XDCs of the current run keyed by canonical path, modification time and size */
+					std::map<std::string, std::string> xdcContentKeys;
+
+					/** Device templates of the current run keyed by XDC content hash and size */
+					std::map<std::string, std::shared_ptr<const DeviceTemplate>> deviceTemplateCache;
+
+					/** Failed extractions of the current run keyed by XDC content hash and size */
+					std::map<std::string, IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult> deviceTemplateFailures;
+
+					/** Content keys taken by a prefetch worker or the import, each is extracted once */
+					std::set<std::string> claimedContentKeys;
+
+					/** Guards the content keys and device templates shared with the prefetch workers */
+					std::mutex templateMutex;
+
+					/** Signals an extracted device template or a failed extraction */
+					std::condition_variable templateCompleted;
+
+					/** Resolved XDC paths taken by the prefetch workers */
+					std::vector<std::string> prefetchPaths;
+
+					/** Index of the next XDC path to be taken by a prefetch worker */
+					std::atomic<std::size_t> nextPrefetchPath;
+
+					/** True once the prefetch workers take no further XDC paths */
+					std::atomic<bool> prefetchStopped;
+
+					/** Prefetch worker threads */
+					std::vector<std::thread> prefetchWorkers;
+
+					/** True if the files of the current run are validated in the background */
+					bool validateInBackground;
+
+					/** Validates the project file and the XDCs while they are imported */
+					BackgroundValidator schemaValidator;
+
+					/** Threads of the extraction budget reserved for the validation */
+					std::size_t validationThreads;
+
+					/** Node assignment attributes of the current run keyed by xpath expression */
+					std::map<std::string, NodeAssignmentTable> nodeAssignmentCache;
 
 			}; // end of class ProjectParser
 		} // end of namespace Application
@@ -0,0 +1,132 @@
+/**
+ * \class PruningDOMParser
+ *
+ * \brief DOM parser that drops subtrees of XDC files which are never imported
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#ifndef PRUNING_DOM_PARSER_H_
+#define PRUNING_DOM_PARSER_H_
+
+#include <string>
+#include <vector>
+
+#include <xercesc/framework/XMLElementDecl.hpp>
+#include <xercesc/framework/XMLEntityDecl.hpp>
+#include <xercesc/framework/XMLAttr.hpp>
+#include <xercesc/util/RefVectorOf.hpp>
+#include <xercesc/util/XMLString.hpp>
+
+#include "ArenaDOMParser.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			/**
+			  * The scanner validates every element against the schema before the
+			  * document handler is called. Only the DOM construction of the
+			  * pruned subtrees is skipped, the validation is unchanged.
+			  */
+			class PruningDOMParser : public ArenaDOMParser
+			{
+				public:
+					/** \brief Constructor of the class
+					  * \param documentMemoryManager 	Memory manager of the documents
+					  * \param grammarPool 				Grammar pool shared with the other parsers
+					  */
+					PruningDOMParser(xercesc::MemoryManager* const documentMemoryManager,
+					                 xercesc::XMLGrammarPool* const grammarPool);
+
+					/** \brief Destructor of the class
+					  */
+					virtual ~PruningDOMParser();
+
+					virtual void resetDocument();
+
+					virtual void startDocument();
+
+					virtual void startElement(const xercesc::XMLElementDecl& elemDecl,
+					                          const unsigned int urlId,
+					                          const XMLCh* const elemPrefix,
+					                          const xercesc::RefVectorOf<xercesc::XMLAttr>& attrList,
+					                          const XMLSize_t attrCount,
+					                          const bool isEmpty,
+					                          const bool isRoot);
+
+					virtual void endElement(const xercesc::XMLElementDecl& elemDecl,
+					                        const unsigned int urlId,
+					                        const bool isRoot,
+					                        const XMLCh* const elemPrefix);
+
+					virtual void docCharacters(const XMLCh* const chars,
+					                           const XMLSize_t length,
+					                           const bool cdataSection);
+
+					virtual void ignorableWhitespace(const XMLCh* const chars,
+					                                 const XMLSize_t length,
+					                                 const bool cdataSection);
+
+					virtual void docComment(const XMLCh* const comment);
+
+					virtual void docPI(const XMLCh* const target,
+					                   const XMLCh* const data);
+
+					virtual void startEntityReference(const xercesc::XMLEntityDecl& entDecl);
+
+					virtual void endEntityReference(const xercesc::XMLEntityDecl& entDecl);
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					PruningDOMParser(const PruningDOMParser&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					PruningDOMParser& operator=(const PruningDOMParser&);
+
+					/** \brief Checks whether an element is dropped with its subtree
+					  * \param elemDecl 	Declaration of the element
+					  * \return true if the element is pruned; false otherwise
+					  */
+					bool IsPruned(const xercesc::XMLElementDecl& elemDecl) const;
+
+					/** Local names of the pruned elements */
+					std::vector<std::basic_string<XMLCh> > prunedElementNames;
+
+					/** Open elements of the pruned subtree, 0 outside of it */
+					XMLSize_t prunedDepth;
+
+			}; // end of class PruningDOMParser
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _PRUNING_DOM_PARSER_H_
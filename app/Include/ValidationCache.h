@@ -0,0 +1,120 @@
+/**
+ * \class ValidationCache
+ *
+ * \brief Records the files which passed the schema validation in a previous run
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#ifndef VALIDATION_CACHE_H_
+#define VALIDATION_CACHE_H_
+
+#include <map>
+#include <mutex>
+
+#include "OpenConfiguratorCli.h"
+
+namespace IndustrialNetwork
+{
+	namespace POWERLINK
+	{
+		namespace Application
+		{
+			/**
+			  * Each validated file is recorded as an empty file named after the
+			  * content keys of the file and of its schema in the cache directory.
+			  * The schema key covers the schema file and every file it includes
+			  * or imports.
+			  */
+			class ValidationCache
+			{
+				public:
+					/** \brief Default constructor of the class
+					  */
+					ValidationCache();
+
+					/** \brief Destructor of the class
+					  */
+					~ValidationCache();
+
+					/** \brief Creates single instance
+					  * \return Static instance of the class
+					  */
+					static ValidationCache& GetInstance();
+
+					/** \brief Computes the key of a file validated against a schema file
+					  * \param fileName 		Name of the validated file
+					  * \param schemaFile 		Name of the schema file
+					  * \param validationKey 	Key of the file and schema content output
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult GetValidationKey(const std::string& fileName,
+					        const std::string& schemaFile,
+					        std::string& validationKey);
+
+					/** \brief Checks whether the key was recorded by a previous run
+					  * \param validationKey 	Key of the file and schema content
+					  * \return true if the file was validated; false otherwise
+					  */
+					bool IsValidated(const std::string& validationKey) const;
+
+					/** \brief Records the key of a successfully validated file
+					  * \param validationKey 	Key of the file and schema content
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult AddValidated(const std::string& validationKey);
+
+				private:
+					/** \brief private copy constructor, no definition (declaration-only) */
+					ValidationCache(const ValidationCache&);
+
+					/** \brief private copy assign, no definition (declaration-only) */
+					ValidationCache& operator=(const ValidationCache&);
+
+					/** \brief Collects a schema file and all schema files it includes,
+					  *        imports or redefines, directly or indirectly
+					  * \param schemaFile 		Name of the schema file
+					  * \param schemaFiles 	Schema files in the order they are found output
+					  * \return CliResult
+					  */
+					IndustrialNetwork::POWERLINK::Application::ErrorHandling::CliResult CollectSchemaFiles(const std::string& schemaFile,
+					        std::vector<std::string>& schemaFiles);
+
+					/** Content keys of the schemas with their included files hashed so far */
+					std::map<std::string, std::string> schemaContentKeys;
+
+					/** Serialises access to the schema content keys and the cache directory */
+					mutable std::mutex cacheMutex;
+
+			}; // end of class ValidationCache
+		} // end of namespace Application
+	} // end of namespace POWERLINK
+} // end of namespace IndustrialNetwork
+
+#endif // _VALIDATION_CACHE_H_
@@ -0,0 +1,70 @@
+/**
+ * \file ArenaDOMParser.cpp
+ *
+ * \brief Implementation of ArenaDOMParser module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "ArenaDOMParser.h"
+
+#include <xercesc/util/PlatformUtils.hpp>
+
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+ArenaDOMParser::ArenaDOMParser(xercesc::MemoryManager* const documentMemoryManager,
+                               xercesc::XMLGrammarPool* const grammarPool) :
+	xercesc::XercesDOMParser(NULL, xercesc::XMLPlatformUtils::fgMemoryManager, grammarPool),
+	documentMemoryManager(documentMemoryManager)
+{
+}
+
+ArenaDOMParser::~ArenaDOMParser()
+{
+}
+
+void ArenaDOMParser::startDocument()
+{
+	/** The base class creates the document on the parser memory manager,
+	    nothing else of the parser is allocated while the document is created */
+	xercesc::MemoryManager* const parserMemoryManager = fMemoryManager;
+	fMemoryManager = documentMemoryManager;
+
+	try
+	{
+		xercesc::XercesDOMParser::startDocument();
+	}
+	catch (...)
+	{
+		fMemoryManager = parserMemoryManager;
+		throw;
+	}
+
+	fMemoryManager = parserMemoryManager;
+}
@@ -0,0 +1,198 @@
+/**
+ * \file ArenaMemoryManager.cpp
+ *
+ * \brief Implementation of ArenaMemoryManager module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "ArenaMemoryManager.h"
+
+#include <new>
+
+#include <xercesc/util/PlatformUtils.hpp>
+#include <xercesc/util/OutOfMemoryException.hpp>
+
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+/** Size of the regular blocks */
+const std::size_t kArenaBlockSize = 256 * 1024;
+
+/** Requests above this size get a block of their own */
+const std::size_t kArenaLargeAllocationSize = kArenaBlockSize / 4;
+
+/** Alignment of every allocation, sufficient for all fundamental types */
+const std::size_t kArenaAlignment = 16;
+
+/** Regular blocks kept by Reset, the rest is given back to the heap */
+const std::size_t kArenaMaxSpareBlocks = 16;
+
+ArenaMemoryManager::ArenaMemoryManager() :
+	blocks(),
+	largeBlocks(),
+	spareBlocks(),
+	current(NULL),
+	remaining(0),
+	allocatedBytes(0),
+	reservedBytes(0)
+{
+}
+
+ArenaMemoryManager::~ArenaMemoryManager()
+{
+	Reset();
+
+	for (char* block : spareBlocks)
+	{
+		::operator delete(block);
+	}
+}
+
+xercesc::MemoryManager* ArenaMemoryManager::getExceptionMemoryManager()
+{
+	/** Exceptions may outlive the arena */
+	return xercesc::XMLPlatformUtils::fgMemoryManager;
+}
+
+void* ArenaMemoryManager::allocate(XMLSize_t size)
+{
+	/** Round up so that the next allocation stays aligned */
+	std::size_t alignedSize = (size + kArenaAlignment - 1) & ~(kArenaAlignment - 1);
+	if (alignedSize == 0)
+	{
+		alignedSize = kArenaAlignment;
+	}
+
+	void* memory = NULL;
+
+	try
+	{
+		/** Large buffers do not waste the rest of the current block */
+		if (alignedSize > kArenaLargeAllocationSize)
+		{
+			memory = AddBlock(alignedSize);
+		}
+		else
+		{
+			if (alignedSize > remaining)
+			{
+				current = AddBlock(kArenaBlockSize);
+				remaining = kArenaBlockSize;
+			}
+
+			memory = current;
+			current += alignedSize;
+			remaining -= alignedSize;
+		}
+	}
+	catch (const std::bad_alloc&)
+	{
+		/** Xerces expects its own exception from a memory manager, like MemoryManagerImpl */
+		throw xercesc::OutOfMemoryException();
+	}
+	allocatedBytes += alignedSize;
+
+	return memory;
+}
+
+void ArenaMemoryManager::deallocate(void*)
+{
+}
+
+std::uint64_t ArenaMemoryManager::GetAllocatedBytes() const
+{
+	return allocatedBytes;
+}
+
+std::uint64_t ArenaMemoryManager::GetReservedBytes() const
+{
+	return reservedBytes;
+}
+
+std::uint32_t ArenaMemoryManager::GetBlockCount() const
+{
+	return (std::uint32_t) (blocks.size() + largeBlocks.size());
+}
+
+void ArenaMemoryManager::Reset()
+{
+	for (char* block : largeBlocks)
+	{
+		::operator delete(block);
+	}
+	largeBlocks.clear();
+
+	for (char* block : blocks)
+	{
+		if (spareBlocks.size() < kArenaMaxSpareBlocks)
+		{
+			spareBlocks.push_back(block);
+		}
+		else
+		{
+			::operator delete(block);
+		}
+	}
+	blocks.clear();
+
+	current = NULL;
+	remaining = 0;
+	allocatedBytes = 0;
+	reservedBytes = spareBlocks.size() * kArenaBlockSize;
+}
+
+char* ArenaMemoryManager::AddBlock(std::size_t size)
+{
+	/** Blocks kept by Reset are already counted as reserved */
+	if ((size == kArenaBlockSize) && !spareBlocks.empty())
+	{
+		blocks.push_back(spareBlocks.back());
+		spareBlocks.pop_back();
+
+		return blocks.back();
+	}
+
+	/** The slot is added first so that a failed push_back does not leak the block,
+	    operator new returns memory aligned for any fundamental type */
+	std::vector<char*>& blockList = (size != kArenaBlockSize) ? largeBlocks : blocks;
+	blockList.push_back(NULL);
+	try
+	{
+		blockList.back() = static_cast<char*>(::operator new(size));
+	}
+	catch (const std::bad_alloc&)
+	{
+		/** An empty slot would be handed out again as a spare block after Reset */
+		blockList.pop_back();
+		throw;
+	}
+	reservedBytes += size;
+
+	return blockList.back();
+}
@@ -0,0 +1,230 @@
+/**
+ * \file BackgroundValidator.cpp
+ *
+ * \brief Implementation of BackgroundValidator module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "BackgroundValidator.h"
+#include "ParserElement.h"
+
+#include <algorithm>
+#include <system_error>
+
+using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+ValidationEntry::ValidationEntry(const std::string& file, const std::string& schemaFile, const std::string& xmlNamespace) :
+	filePath(file),
+	schemaFilePath(schemaFile),
+	xmlNamespace(xmlNamespace),
+	state(ValidationState::PENDING),
+	result()
+{
+}
+
+BackgroundValidator::BackgroundValidator() :
+	entries(),
+	entryIndices(),
+	nextEntry(0),
+	cancelled(false),
+	failure(),
+	hasFailure(false),
+	workers(),
+	validatorMutex(),
+	entryDone()
+{
+}
+
+BackgroundValidator::~BackgroundValidator()
+{
+	Stop();
+}
+
+void BackgroundValidator::AddFile(const std::string& file, const std::string& schemaFile, const std::string& xmlNamespace)
+{
+	std::lock_guard<std::mutex> lock(validatorMutex);
+
+	if (entryIndices.insert(std::make_pair(file, entries.size())).second)
+	{
+		entries.push_back(ValidationEntry(file, schemaFile, xmlNamespace));
+	}
+}
+
+void BackgroundValidator::Start(std::uint32_t workerCount)
+{
+	std::size_t count = std::min<std::size_t>(workerCount, entries.size());
+
+	for (std::size_t worker = 0; worker < count; worker++)
+	{
+		try
+		{
+			workers.push_back(std::thread(&BackgroundValidator::Worker, this));
+		}
+		catch (const std::system_error&)
+		{
+			/** Files without a worker are validated when they are requested */
+			break;
+		}
+	}
+}
+
+CliResult BackgroundValidator::Wait(const std::string& file,
+                                    const std::string& schemaFile,
+                                    const std::string& xmlNamespace)
+{
+	std::size_t index = 0;
+	{
+		std::unique_lock<std::mutex> lock(validatorMutex);
+
+		std::map<std::string, std::size_t>::const_iterator it = entryIndices.find(file);
+		if (it == entryIndices.end())
+		{
+			lock.unlock();
+
+			/** Files not added are validated by the requesting thread */
+			ValidationEntry entry(file, schemaFile, xmlNamespace);
+			return Validate(entry);
+		}
+
+		index = it->second;
+		while (entries.at(index).state == ValidationState::RUNNING)
+		{
+			entryDone.wait(lock);
+		}
+
+		if (entries.at(index).state == ValidationState::DONE)
+		{
+			return entries.at(index).result;
+		}
+
+		/** Not yet claimed by a worker, the requesting thread validates it */
+		entries.at(index).state = ValidationState::RUNNING;
+	}
+
+	CliResult result = Validate(entries.at(index));
+	Complete(index, result);
+
+	return result;
+}
+
+CliResult BackgroundValidator::GetFailure()
+{
+	std::lock_guard<std::mutex> lock(validatorMutex);
+
+	if (hasFailure)
+	{
+		return failure;
+	}
+
+	return CliResult();
+}
+
+void BackgroundValidator::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(validatorMutex);
+		cancelled = true;
+	}
+
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+	workers.clear();
+
+	entries.clear();
+	entryIndices.clear();
+	nextEntry = 0;
+	cancelled = false;
+	failure = CliResult();
+	hasFailure = false;
+}
+
+void BackgroundValidator::Worker()
+{
+	while (true)
+	{
+		std::size_t index = 0;
+		{
+			std::lock_guard<std::mutex> lock(validatorMutex);
+
+			/** Files requested meanwhile are skipped, no more files after a failure */
+			while ((nextEntry < entries.size()) && (entries.at(nextEntry).state != ValidationState::PENDING))
+			{
+				nextEntry++;
+			}
+
+			if (cancelled || hasFailure || (nextEntry >= entries.size()))
+			{
+				return;
+			}
+
+			index = nextEntry++;
+			entries.at(index).state = ValidationState::RUNNING;
+		}
+
+		Complete(index, Validate(entries.at(index)));
+	}
+}
+
+CliResult BackgroundValidator::Validate(const ValidationEntry& entry)
+{
+	try
+	{
+		/** The document of the validation is not used, its unused subtrees are dropped */
+		ParserElement element(entry.filePath, entry.schemaFilePath, entry.xmlNamespace, true);
+
+		return element.CreateElement();
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+}
+
+void BackgroundValidator::Complete(std::size_t index, const CliResult& result)
+{
+	{
+		std::lock_guard<std::mutex> lock(validatorMutex);
+
+		entries.at(index).result = result;
+		entries.at(index).state = ValidationState::DONE;
+
+		CliResult res = result;
+		if (!res.IsSuccessful() && !hasFailure)
+		{
+			failure = result;
+			hasFailure = true;
+		}
+	}
+
+	entryDone.notify_all();
+}
@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ConfigurationGenerator.h"
 #include "ParameterValidator.h"
 #include "ProjectParser.h"
+#include "OutputFileWriter.h"
 
 using namespace IndustrialNetwork::POWERLINK::Core::API;
 using namespace IndustrialNetwork::POWERLINK::Core::ErrorHandling;
@@ -44,6 +45,9 @@ using namespace IndustrialNetwork::POWERLINK::Application;
 using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
 using namespace IndustrialNetwork::POWERLINK::Application::CliConstants;
 
+/** Number of output files of a run: the three MN OBD files and the three MN process image descriptions */
+const std::uint32_t kOutputFileCount = 6;
+
 ConfigurationGenerator::ConfigurationGenerator()
 {
 }
@@ -99,23 +103,36 @@ CliResult ConfigurationGenerator::GenerateOutputFiles(const std::string& xmlPath
 		return cliRes;
 	}
 
+	/** The core builds the outputs one after the other, the files are
+	  * written by the writer threads while the next output is built.
+	  * A single job writes all files itself once they are built. */
+	OutputFileWriter writer(OpenConfiguratorCli::GetInstance().syncOutputFiles);
+	writer.Start(std::min<std::uint32_t>(OpenConfiguratorCli::GetInstance().jobCount - 1, kOutputFileCount));
+
 	/** Generate output files */
-	cliRes = BuildConciseDeviceConfiguration(outputPath);
-	if (!cliRes.IsSuccessful())
+	cliRes = BuildConciseDeviceConfiguration(outputPath, writer);
+	if (cliRes.IsSuccessful())
 	{
-		return cliRes;
+		cliRes = BuildProcessImageDescriptions(outputPath, writer);
 	}
 
-	cliRes = BuildProcessImageDescriptions(outputPath);
+	/** A failed build keeps the outputs of the previous run */
+	CliResult writeRes = writer.Finish(cliRes.IsSuccessful());
 	if (!cliRes.IsSuccessful())
 	{
 		return cliRes;
 	}
 
+	if (!writeRes.IsSuccessful())
+	{
+		return writeRes;
+	}
+
 	return CliResult();
 }
 
-CliResult ConfigurationGenerator::BuildConciseDeviceConfiguration(const std::string& outputPath)
+CliResult ConfigurationGenerator::BuildConciseDeviceConfiguration(const std::string& outputPath,
+        OutputFileWriter& writer)
 {
 	std::vector<std::uint8_t> binOutput;		/** binary output vector */
 	std::string configurationOutput = "";		/** configuration output stream */
@@ -131,7 +148,7 @@ CliResult ConfigurationGenerator::BuildConciseDeviceConfiguration(const std::str
 		return CliLogger::GetInstance().GetFailureErrorString(res);
 	}
 
-	cliRes = CreateMnobdTxt(outputPath, configurationOutput);
+	cliRes = CreateMnobdTxt(outputPath, configurationOutput, writer);
 	if (!cliRes.IsSuccessful())
 	{
 		LOG_ERROR() << CliLogger::GetInstance().GetErrorString(cliRes);
@@ -139,30 +156,34 @@ CliResult ConfigurationGenerator::BuildConciseDeviceConfiguration(const std::str
 		return CliResult(CliErrorCode::FAILURE);
 	}
 
-	std::ostringstream buffer;
-	/** Convert binary values in to a buffer stream */
-	for (std::uint32_t index = 0; index < binOutput.size(); index++)
+	try
 	{
-		std::uint8_t value = binOutput.at(index);
-		buffer << (value);
-	}
+		/** The binary and hex outputs are written from the same buffer */
+		std::shared_ptr<std::vector<std::uint8_t> > sharedOutput(new std::vector<std::uint8_t>());
+		sharedOutput->swap(binOutput);
 
-	cliRes = CreateMnobdCdc(outputPath, buffer);
-	if (!cliRes.IsSuccessful())
-	{
-		return cliRes;
-	}
+		cliRes = CreateMnobdCdc(outputPath, sharedOutput, writer);
+		if (!cliRes.IsSuccessful())
+		{
+			return cliRes;
+		}
 
-	cliRes = CreateMnobdHexTxt(outputPath, buffer);
-	if (!cliRes.IsSuccessful())
+		cliRes = CreateMnobdHexTxt(outputPath, sharedOutput, writer);
+		if (!cliRes.IsSuccessful())
+		{
+			return cliRes;
+		}
+	}
+	catch (const std::exception& e)
 	{
-		return cliRes;
+		return CliLogger::GetInstance().GetFailureErrorString(e);
 	}
 
 	return CliResult();
 }
 
-CliResult ConfigurationGenerator::BuildProcessImageDescriptions(const std::string& outputPath)
+CliResult ConfigurationGenerator::BuildProcessImageDescriptions(const std::string& outputPath,
+        OutputFileWriter& writer)
 {
 	CliResult cliRes;
 	std::vector<std::uint8_t> nodeIdCollection;
@@ -188,19 +209,19 @@ CliResult ConfigurationGenerator::BuildProcessImageDescriptions(const std::strin
 			continue;
 		}
 
-		cliRes = CreateCProcessImage(value, outputPathExtended);
+		cliRes = CreateCProcessImage(value, outputPathExtended, writer);
 		if (!cliRes.IsSuccessful())
 		{
 			return cliRes;
 		}
 
-		cliRes = CreateXmlProcessImage(value, outputPathExtended);
+		cliRes = CreateXmlProcessImage(value, outputPathExtended, writer);
 		if (!cliRes.IsSuccessful())
 		{
 			return cliRes;
 		}
 
-		cliRes = CreateCSharpProcessImage(value, outputPathExtended);
+		cliRes = CreateCSharpProcessImage(value, outputPathExtended, writer);
 		if (!cliRes.IsSuccessful())
 		{
 			return cliRes;
@@ -211,18 +232,14 @@ CliResult ConfigurationGenerator::BuildProcessImageDescriptions(const std::strin
 }
 
 CliResult ConfigurationGenerator::CreateMnobdTxt(const std::string& outputPath,
-        const std::string& configuration)
+        std::string& configuration, OutputFileWriter& writer)
 {
 	try
 	{
-		std::string targetPath = outputPath + kPathSeparator + kMnobdTxtFileName;
-		std::ofstream ofile(targetPath);
+		OutputFile file(outputPath + kPathSeparator + kMnobdTxtFileName, OutputFileFormat::TEXT);
+		file.text.swap(configuration);
 
-		if (ofile.is_open())
-		{
-			ofile << configuration << std::endl;
-			ofile.close();
-		}
+		writer.Add(file);
 	}
 	catch (const std::exception& e)
 	{
@@ -233,18 +250,15 @@ CliResult ConfigurationGenerator::CreateMnobdTxt(const std::string& outputPath,
 }
 
 CliResult ConfigurationGenerator::CreateMnobdCdc(const std::string& outputPath,
-        const std::ostringstream& buffer)
+        const std::shared_ptr<const std::vector<std::uint8_t> >& binOutput, OutputFileWriter& writer)
 {
 	try
 	{
-		std::string targetPath = outputPath + kPathSeparator + kMnobdCdcFileName;
-		std::ofstream ofile(targetPath);
+		/** The CDC is binary, it is written unchanged without a line end */
+		OutputFile file(outputPath + kPathSeparator + kMnobdCdcFileName, OutputFileFormat::BINARY);
+		file.binary = binOutput;
 
-		if (ofile.is_open())
-		{
-			ofile << buffer.str() << std::endl;
-			ofile.close();
-		}
+		writer.Add(file);
 	}
 	catch (const std::exception& e)
 	{
@@ -255,59 +269,14 @@ CliResult ConfigurationGenerator::CreateMnobdCdc(const std::string& outputPath,
 }
 
 CliResult ConfigurationGenerator::CreateMnobdHexTxt(const std::string& outputPath,
-        const std::ostringstream& buffer)
+        const std::shared_ptr<const std::vector<std::uint8_t> >& binOutput, OutputFileWriter& writer)
 {
 	try
 	{
-		const std::uint8_t kWordWrapLength = 16;
-
-		std::ostringstream toStream;
-		std::uint8_t lineBreakCount = 0;
+		OutputFile file(outputPath + kPathSeparator + kMnobdHexTxtFileName, OutputFileFormat::HEX_TEXT);
+		file.binary = binOutput;
 
-		/** Formatting the mnob hex text stream */
-		for (std::uint32_t cnt = 0; cnt < buffer.str().size(); ++cnt)
-		{
-			std::ostringstream hexVal;
-
-			hexVal << std::setw(2) << std::setfill('0') << std::hex << std::uppercase << std::int16_t(buffer.str().at(cnt));
-			toStream << "0x";
-			if (hexVal.str().size() > 2)
-			{
-				toStream << hexVal.str().substr(2, 2);
-			}
-			else
-			{
-				toStream << hexVal.str();
-			}
-
-			if (cnt != (buffer.str().size() - 1))
-			{
-				toStream << ",";
-			}
-
-			lineBreakCount++;
-
-			if (lineBreakCount == kWordWrapLength)
-			{
-				toStream << "\n";
-				lineBreakCount = 0;
-			}
-			else
-			{
-				toStream << " ";
-			}
-		}
-
-		std::string targetPath = outputPath + kPathSeparator + kMnobdHexTxtFileName;
-		std::ofstream ofile(targetPath);
-
-		if (ofile.is_open())
-		{
-			/** Conversion to be added */
-			ofile << toStream.str() << std::endl;
-
-			ofile.close();
-		}
+		writer.Add(file);
 	}
 	catch (const std::exception& e)
 	{
@@ -317,9 +286,8 @@ CliResult ConfigurationGenerator::CreateMnobdHexTxt(const std::string& outputPat
 	return CliResult();
 }
 
-
 CliResult ConfigurationGenerator::CreateCProcessImage(const std::uint8_t nodeId,
-        const std::string& outputPath)
+        const std::string& outputPath, OutputFileWriter& writer)
 {
 	std::string piDataOutput = "";
 
@@ -333,14 +301,10 @@ CliResult ConfigurationGenerator::CreateCProcessImage(const std::uint8_t nodeId,
 
 	try
 	{
-		std::string targetPath = outputPath + kPathSeparator + kXapHFileName;
-		std::ofstream ofile(targetPath);
+		OutputFile file(outputPath + kPathSeparator + kXapHFileName, OutputFileFormat::TEXT);
+		file.text.swap(piDataOutput);
 
-		if (ofile.is_open())
-		{
-			ofile << piDataOutput << std::endl;
-			ofile.close();
-		}
+		writer.Add(file);
 	}
 	catch (const std::exception& e)
 	{
@@ -351,7 +315,7 @@ CliResult ConfigurationGenerator::CreateCProcessImage(const std::uint8_t nodeId,
 }
 
 CliResult ConfigurationGenerator::CreateXmlProcessImage(const std::uint8_t nodeId,
-        const std::string& outputPath)
+        const std::string& outputPath, OutputFileWriter& writer)
 {
 	std::string piDataOutput = "";
 
@@ -365,14 +329,10 @@ CliResult ConfigurationGenerator::CreateXmlProcessImage(const std::uint8_t nodeI
 
 	try
 	{
-		std::string targetPath = outputPath + kPathSeparator + kXapXmlFileName;
-		std::ofstream ofile(targetPath);
+		OutputFile file(outputPath + kPathSeparator + kXapXmlFileName, OutputFileFormat::TEXT);
+		file.text.swap(piDataOutput);
 
-		if (ofile.is_open())
-		{
-			ofile << piDataOutput << std::endl;
-			ofile.close();
-		}
+		writer.Add(file);
 	}
 	catch (const std::exception& e)
 	{
@@ -383,7 +343,7 @@ CliResult ConfigurationGenerator::CreateXmlProcessImage(const std::uint8_t nodeI
 }
 
 CliResult ConfigurationGenerator::CreateCSharpProcessImage(const std::uint8_t nodeId,
-        const std::string& outputPath)
+        const std::string& outputPath, OutputFileWriter& writer)
 {
 	std::string piDataOutput = "";
 
@@ -397,14 +357,10 @@ CliResult ConfigurationGenerator::CreateCSharpProcessImage(const std::uint8_t no
 
 	try
 	{
-		std::string targetPath = outputPath + kPathSeparator + kProcessImageFileName;
-		std::ofstream ofile(targetPath);
+		OutputFile file(outputPath + kPathSeparator + kProcessImageFileName, OutputFileFormat::TEXT);
+		file.text.swap(piDataOutput);
 
-		if (ofile.is_open())
-		{
-			ofile << piDataOutput << std::endl;
-			ofile.close();
-		}
+		writer.Add(file);
 	}
 	catch (const std::exception& e)
 	{
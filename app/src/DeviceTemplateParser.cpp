@@ -0,0 +1,1122 @@
+/**
+ * \file DeviceTemplateParser.cpp
+ *
+ * \brief Implementation of DeviceTemplateParser module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#include <iomanip>
+#include <thread>
+#include <exception>
+#include <system_error>
+
+#include "DeviceTemplateParser.h"
+#include "ParserResult.h"
+#include "NumberConverter.h"
+#include "EnumConverter.h"
+
+using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
+using namespace IndustrialNetwork::POWERLINK::Core::ObjectDictionary;
+using namespace IndustrialNetwork::POWERLINK::Application;
+using namespace IndustrialNetwork::POWERLINK::Application::CliConstants;
+
+/** FNV-1a offset basis and prime for the 64 bit content hash */
+const std::uint64_t kFnvOffsetBasis = 0xCBF29CE484222325ULL;
+const std::uint64_t kFnvPrime = 0x100000001B3ULL;
+
+/** Size of the chunks in which a file is read for hashing */
+const std::size_t kHashReadChunkSize = 64 * 1024;
+
+/** Minimum number of objects extracted by one thread of a large object list */
+const std::size_t kObjectChunkSize = 1024;
+
+/** Field table of objects, the module attribute rangeSelector is a superset of the node attributes */
+const XdcObjectFieldType kObjectFields[] =
+{
+	{"index", XdcObjectField::INDEX},
+	{"name", XdcObjectField::NAME},
+	{"objectType", XdcObjectField::OBJECT_TYPE},
+	{"defaultValue", XdcObjectField::DEFAULT_VALUE},
+	{"dataType", XdcObjectField::DATA_TYPE},
+	{"accessType", XdcObjectField::ACCESS_TYPE},
+	{"PDOmapping", XdcObjectField::PDO_MAPPING},
+	{"actualValue", XdcObjectField::ACTUAL_VALUE},
+	{"uniqueIDRef", XdcObjectField::UNIQUE_ID_REF},
+	{"lowLimit", XdcObjectField::LOW_LIMIT},
+	{"highLimit", XdcObjectField::HIGH_LIMIT},
+	{"rangeSelector", XdcObjectField::RANGE_SELECTOR}
+};
+
+/** Field table of sub-objects */
+const XdcObjectFieldType kSubObjectFields[] =
+{
+	{"subIndex", XdcObjectField::INDEX},
+	{"name", XdcObjectField::NAME},
+	{"objectType", XdcObjectField::OBJECT_TYPE},
+	{"defaultValue", XdcObjectField::DEFAULT_VALUE},
+	{"dataType", XdcObjectField::DATA_TYPE},
+	{"accessType", XdcObjectField::ACCESS_TYPE},
+	{"PDOmapping", XdcObjectField::PDO_MAPPING},
+	{"actualValue", XdcObjectField::ACTUAL_VALUE},
+	{"uniqueIDRef", XdcObjectField::UNIQUE_ID_REF},
+	{"lowLimit", XdcObjectField::LOW_LIMIT},
+	{"highLimit", XdcObjectField::HIGH_LIMIT}
+};
+
+DeviceTemplateParser::DeviceTemplateParser() :
+	attributeNameMap(std::map<std::string, std::vector<std::basic_string<XMLCh> > >()),
+	objectAttributeNames(),
+	subObjectAttributeNames(),
+	reservedThreads(0)
+{
+	/** Attribute names of all format strings, split once for all templates */
+	const std::string formatStrings[] =
+	{
+		kFormatStrStructXpathExpression, kFormatStrStructVarXpathExpression,
+		kFormatStrArrayXpathExpression, kFormatStrArraySubRangeXpathExpression,
+		kFormatStrParameterTemplateXpathExpression, kFormatStrParameterXpathExpression,
+		kFormatStrParameterDataTypeIdRefXpathExpression, kFormatStrParameterAllowedValueXpathExpression,
+		kFormatStrParameterAllowedValueRangeXpathExpression, kFormatStrParameterMinValueXpathExpression,
+		kFormatStrParameterMaxValueXpathExpression, kFormatStrParameterDefaultValueXpathExpression,
+		kFormatStrParameterActualValueXpathExpression, kFormatStrParameterGroupXpathExpression,
+		kFormatStrChildParameterRefXpathExpression,
+		kFormatStrDynamicChnlXpathExpressionModule, kFormatStrGeneralFeatureXpathExpression,
+		kFormatStrMnFeatureXpathExpression, kFormatStrCnFeatureXpathExpression,
+		kFormatStrInterfaceXdcXpathExpression, kFormatStrAppLayerInterfaceXpathExpression,
+		kFormatStrInterfaceRangeXpathExpression, kFormatStrModuleNodeXpathExpression
+	};
+
+	for (const std::string& formatString : formatStrings)
+	{
+		attributeNameMap.insert(std::make_pair(formatString, ParserResult::GetAttributeNames(formatString)));
+	}
+
+	/** Attribute names are ASCII, they are widened without a transcoder */
+	for (const XdcObjectFieldType& field : kObjectFields)
+	{
+		std::string name(field.attributeName);
+		objectAttributeNames.push_back(std::basic_string<XMLCh>(name.begin(), name.end()));
+	}
+	for (const XdcObjectFieldType& field : kSubObjectFields)
+	{
+		std::string name(field.attributeName);
+		subObjectAttributeNames.push_back(std::basic_string<XMLCh>(name.begin(), name.end()));
+	}
+}
+
+DeviceTemplateParser::~DeviceTemplateParser()
+{
+}
+
+DeviceTemplateParser& DeviceTemplateParser::GetInstance()
+{
+	static DeviceTemplateParser instance;
+
+	return instance;
+}
+
+CliResult DeviceTemplateParser::CreateDeviceTemplate(const ParserElement& element,
+        DeviceTemplate& deviceTemplate)
+{
+	try
+	{
+		if (element.domElement == NULL)
+		{
+			return CliResult(CliErrorCode::NULL_POINTER_FOUND,
+			                 kMsgNullPtrFound[CliLogger::GetInstance().languageIndex]);
+		}
+
+		/** Every section keeps its own result, it is reported when the template is replayed.
+		    Sections not visited below keep the result of a query without match. */
+		deviceTemplate.structResult = GetNoResult(kStructXpathExpression);
+		deviceTemplate.arrayResult = GetNoResult(kArrayXpathExpression);
+		deviceTemplate.parameterTemplateResult = GetNoResult(kParameterTemplateXpathExpression);
+		deviceTemplate.parameterResult = GetNoResult(kParameterXpathExpression);
+		deviceTemplate.parameterGroupResult = GetNoResult(kParameterGroupXpathExpression);
+		deviceTemplate.objectResult = GetNoResult(kObjectXpathExpression);
+		deviceTemplate.dynamicChannelResult = GetNoResult(kDynamicChnlXpathExpression);
+		deviceTemplate.generalFeatureResult = GetNoResult(kGeneralFeatureXpathExpression);
+		deviceTemplate.mnFeatureResult = GetNoResult(kMnFeatureXpathExpression);
+		deviceTemplate.cnFeatureResult = GetNoResult(kCnFeatureXpathExpression);
+		deviceTemplate.interfaceResult = GetNoResult(kInterfaceXdcXpathExpression);
+		deviceTemplate.appLayerInterfaceResult = GetNoResult(kAppLayerInterfaceXpathExpression);
+		deviceTemplate.moduleInterfaceResult = GetNoResult(kModuleNodeXpathExpression);
+
+		if (GetElementName(element.domElement).compare("ISO15745ProfileContainer") != 0)
+		{
+			return CliResult();
+		}
+
+		/** Visit the profile bodies once in document order and fill all sections */
+		for (const xercesc::DOMNode* profile = element.domElement->getFirstChild(); profile != NULL; profile = profile->getNextSibling())
+		{
+			if (GetElementName(profile).compare("ISO15745Profile") != 0)
+			{
+				continue;
+			}
+
+			for (const xercesc::DOMNode* profileBody = profile->getFirstChild(); profileBody != NULL; profileBody = profileBody->getNextSibling())
+			{
+				if (GetElementName(profileBody).compare("ProfileBody") != 0)
+				{
+					continue;
+				}
+
+				for (const xercesc::DOMNode* section = profileBody->getFirstChild(); section != NULL; section = section->getNextSibling())
+				{
+					std::string sectionName = GetElementName(section);
+
+					if (sectionName.compare("ApplicationProcess") == 0)
+					{
+						VisitApplicationProcess(section, deviceTemplate);
+					}
+					else if (sectionName.compare("ApplicationLayers") == 0)
+					{
+						VisitApplicationLayers(section, deviceTemplate);
+					}
+					else if (sectionName.compare("NetworkManagement") == 0)
+					{
+						VisitNetworkManagement(section, deviceTemplate);
+					}
+					else if (sectionName.compare("DeviceManager") == 0)
+					{
+						VisitDeviceManager(section, deviceTemplate);
+					}
+				}
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
+
+CliResult DeviceTemplateParser::GetContentKey(const std::string& fileName,
+        std::string& contentKey)
+{
+	return GetContentKey(std::vector<std::string>(1, fileName), contentKey);
+}
+
+CliResult DeviceTemplateParser::GetContentKey(const std::vector<std::string>& fileNames,
+        std::string& contentKey)
+{
+	try
+	{
+		std::uint64_t hash = kFnvOffsetBasis;
+		std::uint64_t size = 0;
+		std::vector<char> buffer(kHashReadChunkSize);
+
+		for (const std::string& fileName : fileNames)
+		{
+			std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+			if (!file.is_open())
+			{
+				boost::format formatter(kMsgFileNotExists[CliLogger::GetInstance().languageIndex]);
+				formatter % fileName;
+
+				return CliResult(CliErrorCode::FILE_NOT_EXISTS, formatter.str());
+			}
+
+			while (file)
+			{
+				file.read(buffer.data(), buffer.size());
+
+				const std::streamsize count = file.gcount();
+				for (std::streamsize index = 0; index < count; index++)
+				{
+					hash ^= (std::uint8_t) buffer[index];
+					hash *= kFnvPrime;
+				}
+				size += (std::uint64_t) count;
+			}
+		}
+
+		std::ostringstream keyString;
+		keyString << std::hex << std::setfill('0') << std::setw(16) << hash
+		          << "-" << std::dec << size;
+		contentKey = keyString.str();
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
+
+std::size_t DeviceTemplateParser::ReserveThreads(const std::size_t count)
+{
+	const std::size_t budget = OpenConfiguratorCli::GetInstance().jobCount;
+	std::size_t reserved = reservedThreads.load();
+	std::size_t granted = 0;
+
+	do
+	{
+		granted = (reserved < budget) ? std::min(count, budget - reserved) : 0;
+	}
+	while ((granted != 0) && !reservedThreads.compare_exchange_weak(reserved, reserved + granted));
+
+	return granted;
+}
+
+void DeviceTemplateParser::ReleaseThreads(const std::size_t count)
+{
+	reservedThreads -= count;
+}
+
+void DeviceTemplateParser::VisitApplicationProcess(const xercesc::DOMNode* node,
+        DeviceTemplate& deviceTemplate)
+{
+	for (const xercesc::DOMNode* list = node->getFirstChild(); list != NULL; list = list->getNextSibling())
+	{
+		std::string listName = GetElementName(list);
+
+		for (const xercesc::DOMNode* child = list->getFirstChild(); child != NULL; child = child->getNextSibling())
+		{
+			std::string childName = GetElementName(child);
+
+			if ((listName.compare("dataTypeList") == 0) && (childName.compare("struct") == 0))
+			{
+				deviceTemplate.structResult = CliResult();
+				ExtractStructType(child, deviceTemplate);
+			}
+			else if ((listName.compare("dataTypeList") == 0) && (childName.compare("array") == 0))
+			{
+				deviceTemplate.arrayResult = CliResult();
+				ExtractArrayType(child, deviceTemplate);
+			}
+			else if ((listName.compare("templateList") == 0) && (childName.compare("parameterTemplate") == 0))
+			{
+				deviceTemplate.parameterTemplateResult = CliResult();
+				ExtractParameter(child, kFormatStrParameterTemplateXpathExpression,
+				                 kFormatStrParameterDataTypeIdRefXpathExpression,
+				                 true, deviceTemplate);
+			}
+			else if ((listName.compare("parameterGroupList") == 0) && (childName.compare("parameterGroup") == 0))
+			{
+				deviceTemplate.parameterGroupResult = CliResult();
+				ExtractParameterGroup(child, deviceTemplate);
+			}
+			else if ((listName.compare("parameterList") == 0) && (childName.compare("parameter") == 0))
+			{
+				deviceTemplate.parameterResult = CliResult();
+				ExtractParameter(child, kFormatStrParameterXpathExpression,
+				                 kFormatStrAppLayerInterfaceXpathExpression,
+				                 false, deviceTemplate);
+			}
+		}
+	}
+}
+
+void DeviceTemplateParser::VisitApplicationLayers(const xercesc::DOMNode* node,
+        DeviceTemplate& deviceTemplate)
+{
+	for (const xercesc::DOMNode* list = node->getFirstChild(); list != NULL; list = list->getNextSibling())
+	{
+		std::string listName = GetElementName(list);
+
+		if (listName.compare("ObjectList") == 0)
+		{
+			ExtractObjectList(list, deviceTemplate);
+		}
+		else if (listName.compare("dynamicChannels") == 0)
+		{
+			CliResult res = ExtractChildRows(list, "dynamicChannel", kDynamicChnlXpathExpression,
+			                                 kFormatStrDynamicChnlXpathExpressionModule,
+			                                 deviceTemplate.dynamicChannels);
+			if (res.IsSuccessful())
+			{
+				deviceTemplate.dynamicChannelResult = res;
+			}
+		}
+		else if (listName.compare("moduleManagement") == 0)
+		{
+			/** Application layer interfaces are only present in the XDC of a modular head node */
+			for (const xercesc::DOMNode* interfaceList = list->getFirstChild(); interfaceList != NULL; interfaceList = interfaceList->getNextSibling())
+			{
+				if (GetElementName(interfaceList).compare("interfaceList") != 0)
+				{
+					continue;
+				}
+
+				for (const xercesc::DOMNode* child = interfaceList->getFirstChild(); child != NULL; child = child->getNextSibling())
+				{
+					if (GetElementName(child).compare("interface") == 0)
+					{
+						deviceTemplate.appLayerInterfaceResult = CliResult();
+						ExtractAppLayerInterface(child, deviceTemplate);
+					}
+				}
+			}
+		}
+	}
+}
+
+void DeviceTemplateParser::VisitNetworkManagement(const xercesc::DOMNode* node,
+        DeviceTemplate& deviceTemplate)
+{
+	std::vector<std::string> row;
+
+	for (const xercesc::DOMNode* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+	{
+		std::string childName = GetElementName(child);
+
+		if (childName.compare("GeneralFeatures") == 0)
+		{
+			deviceTemplate.generalFeatureResult = CliResult();
+			if (GetAttributeRow(child, kFormatStrGeneralFeatureXpathExpression, row))
+			{
+				deviceTemplate.generalFeatures.push_back(row);
+			}
+		}
+		else if (childName.compare("MNFeatures") == 0)
+		{
+			deviceTemplate.mnFeatureResult = CliResult();
+			if (GetAttributeRow(child, kFormatStrMnFeatureXpathExpression, row))
+			{
+				deviceTemplate.mnFeatures.push_back(row);
+			}
+		}
+		else if (childName.compare("CNFeatures") == 0)
+		{
+			deviceTemplate.cnFeatureResult = CliResult();
+			if (GetAttributeRow(child, kFormatStrCnFeatureXpathExpression, row))
+			{
+				deviceTemplate.cnFeatures.push_back(row);
+			}
+		}
+	}
+}
+
+void DeviceTemplateParser::VisitDeviceManager(const xercesc::DOMNode* node,
+        DeviceTemplate& deviceTemplate)
+{
+	std::vector<std::string> row;
+
+	for (const xercesc::DOMNode* moduleManagement = node->getFirstChild(); moduleManagement != NULL; moduleManagement = moduleManagement->getNextSibling())
+	{
+		if (GetElementName(moduleManagement).compare("moduleManagement") != 0)
+		{
+			continue;
+		}
+
+		for (const xercesc::DOMNode* child = moduleManagement->getFirstChild(); child != NULL; child = child->getNextSibling())
+		{
+			std::string childName = GetElementName(child);
+
+			if (childName.compare("interfaceList") == 0)
+			{
+				/** Interfaces are only present in the XDC of a modular head node */
+				CliResult res = ExtractChildRows(child, "interface", kInterfaceXdcXpathExpression,
+				                                 kFormatStrInterfaceXdcXpathExpression,
+				                                 deviceTemplate.interfaces);
+				if (res.IsSuccessful())
+				{
+					deviceTemplate.interfaceResult = res;
+				}
+			}
+			else if (childName.compare("moduleInterface") == 0)
+			{
+				/** Module interfaces are only present in the XDC of a module */
+				deviceTemplate.moduleInterfaceResult = CliResult();
+				if (GetAttributeRow(child, kFormatStrModuleNodeXpathExpression, row))
+				{
+					deviceTemplate.moduleInterfaces.push_back(row);
+				}
+			}
+		}
+	}
+}
+
+void DeviceTemplateParser::ExtractStructType(const xercesc::DOMNode* node,
+        DeviceTemplate& deviceTemplate)
+{
+	XdcStructType structType;
+
+	if (!GetAttributeRow(node, kFormatStrStructXpathExpression, structType.attributes))
+	{
+		return;
+	}
+
+	structType.varDeclarationResult = GetNoResult(kStructVarXpathExpression);
+
+	for (const xercesc::DOMNode* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+	{
+		if (GetElementName(child).compare("varDeclaration") == 0)
+		{
+			XdcVarDeclarationType varDeclaration;
+
+			structType.varDeclarationResult = CliResult();
+			if (GetAttributeRow(child, kFormatStrStructVarXpathExpression, varDeclaration.attributes))
+			{
+				varDeclaration.dataType = GetIecDataType(child);
+				structType.varDeclarations.push_back(varDeclaration);
+			}
+		}
+	}
+
+	deviceTemplate.structs.push_back(structType);
+	AddUniqueId(structType.attributes.at(0), XdcUniqueIdKind::STRUCT,
+	            deviceTemplate.structs.size() - 1, deviceTemplate);
+}
+
+void DeviceTemplateParser::ExtractArrayType(const xercesc::DOMNode* node,
+        DeviceTemplate& deviceTemplate)
+{
+	XdcArrayType arrayType;
+
+	if (!GetAttributeRow(node, kFormatStrArrayXpathExpression, arrayType.attributes))
+	{
+		return;
+	}
+
+	arrayType.dataType = GetIecDataType(node);
+	arrayType.subRangeResult = ExtractChildRows(node, "subrange", kArraySubRangeXpathExpression,
+	                           kFormatStrArraySubRangeXpathExpression,
+	                           arrayType.subRanges);
+
+	deviceTemplate.arrays.push_back(arrayType);
+	AddUniqueId(arrayType.attributes.at(0), XdcUniqueIdKind::ARRAY,
+	            deviceTemplate.arrays.size() - 1, deviceTemplate);
+}
+
+void DeviceTemplateParser::ExtractParameter(const xercesc::DOMNode* node,
+        const std::string& formatString,
+        const std::string& dataTypeIdRefFormat,
+        const bool isTemplate,
+        DeviceTemplate& deviceTemplate)
+{
+	XdcParameterType parameter;
+
+	if (!GetAttributeRow(node, formatString, parameter.attributes))
+	{
+		return;
+	}
+
+	parameter.dataType = GetIecDataType(node);
+
+	/** Parameters referring a template take the data type from the template */
+	if (isTemplate || parameter.attributes.at(2).empty())
+	{
+		parameter.dataTypeIdRefResult = ExtractChildRows(node, "dataTypeIDRef",
+		                                kParameterDataTypeIdRefXpathExpression,
+		                                dataTypeIdRefFormat,
+		                                parameter.dataTypeIdRefs);
+	}
+
+	ExtractParameterValues(node, parameter);
+
+	if (isTemplate)
+	{
+		deviceTemplate.parameterTemplates.push_back(parameter);
+		AddUniqueId(parameter.attributes.at(0), XdcUniqueIdKind::PARAMETER_TEMPLATE,
+		            deviceTemplate.parameterTemplates.size() - 1, deviceTemplate);
+	}
+	else
+	{
+		deviceTemplate.parameters.push_back(parameter);
+		AddUniqueId(parameter.attributes.at(0), XdcUniqueIdKind::PARAMETER,
+		            deviceTemplate.parameters.size() - 1, deviceTemplate);
+	}
+}
+
+void DeviceTemplateParser::ExtractParameterValues(const xercesc::DOMNode* node,
+        XdcParameterType& parameter)
+{
+	std::vector<std::string> row;
+	bool defaultValueFound = false;
+	bool actualValueFound = false;
+
+	parameter.allowedValueResult = GetNoResult(kParameterAllowedValueXpathExpression);
+	parameter.allowedRangeResult = GetNoResult(kParameterAllowedValueRangeXpathExpression);
+	parameter.defaultValueResult = GetNoResult(kParameterDefaultValueXpathExpression);
+	parameter.actualValueResult = GetNoResult(kParameterActualValueXpathExpression);
+
+	for (const xercesc::DOMNode* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+	{
+		std::string childName = GetElementName(child);
+
+		if (childName.compare("allowedValues") == 0)
+		{
+			ExtractAllowedValues(child, parameter);
+		}
+		else if (childName.compare("defaultValue") == 0)
+		{
+			/** Only the first value with attributes is taken */
+			parameter.defaultValueResult = CliResult();
+			if (!defaultValueFound && GetAttributeRow(child, kFormatStrParameterDefaultValueXpathExpression, row))
+			{
+				parameter.defaultValue = row.at(0);
+				defaultValueFound = true;
+			}
+		}
+		else if (childName.compare("actualValue") == 0)
+		{
+			parameter.actualValueResult = CliResult();
+			if (!actualValueFound && GetAttributeRow(child, kFormatStrParameterActualValueXpathExpression, row))
+			{
+				parameter.actualValue = row.at(0);
+				actualValueFound = true;
+			}
+		}
+	}
+}
+
+void DeviceTemplateParser::ExtractAllowedValues(const xercesc::DOMNode* node,
+        XdcParameterType& parameter)
+{
+	std::vector<std::string> row;
+
+	for (const xercesc::DOMNode* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+	{
+		std::string childName = GetElementName(child);
+
+		if (childName.compare("value") == 0)
+		{
+			parameter.allowedValueResult = CliResult();
+			if (GetAttributeRow(child, kFormatStrParameterAllowedValueXpathExpression, row))
+			{
+				parameter.allowedValues.push_back(row.at(0));
+			}
+		}
+		else if (childName.compare("range") == 0)
+		{
+			XdcAllowedRangeType allowedRange;
+			bool minValueFound = false;
+			bool maxValueFound = false;
+
+			/** Like the XPath import, a range needs attributes to produce a record */
+			parameter.allowedRangeResult = CliResult();
+			if (!child->hasAttributes())
+			{
+				continue;
+			}
+
+			for (const xercesc::DOMNode* limit = child->getFirstChild(); limit != NULL; limit = limit->getNextSibling())
+			{
+				std::string limitName = GetElementName(limit);
+
+				if (!minValueFound && (limitName.compare("minValue") == 0)
+				        && GetAttributeRow(limit, kFormatStrParameterMinValueXpathExpression, row))
+				{
+					allowedRange.minValue = row.at(0);
+					minValueFound = true;
+				}
+				else if (!maxValueFound && (limitName.compare("maxValue") == 0)
+				         && GetAttributeRow(limit, kFormatStrParameterMaxValueXpathExpression, row))
+				{
+					allowedRange.maxValue = row.at(0);
+					maxValueFound = true;
+				}
+			}
+
+			parameter.allowedRanges.push_back(allowedRange);
+		}
+	}
+}
+
+void DeviceTemplateParser::ExtractParameterGroup(const xercesc::DOMNode* node,
+        DeviceTemplate& deviceTemplate)
+{
+	/** Groups still to be visited with the uniqueID of their parent group */
+	std::vector<std::pair<const xercesc::DOMNode*, std::string> > groupStack;
+	std::vector<const xercesc::DOMNode*> childGroups;
+	std::vector<std::string> row;
+
+	groupStack.push_back(std::make_pair(node, std::string()));
+
+	while (!groupStack.empty())
+	{
+		const xercesc::DOMNode* groupNode = groupStack.back().first;
+		XdcParameterGroupType parameterGroup;
+		parameterGroup.parentUniqueId.swap(groupStack.back().second);
+		groupStack.pop_back();
+
+		/** Nested groups of a group without attributes are skipped with it */
+		if (!GetAttributeRow(groupNode, kFormatStrParameterGroupXpathExpression, parameterGroup.attributes))
+		{
+			continue;
+		}
+
+		parameterGroup.parameterRefResult = GetNoResult(kChildParameterRefXpathExpression);
+		childGroups.clear();
+
+		for (const xercesc::DOMNode* child = groupNode->getFirstChild(); child != NULL; child = child->getNextSibling())
+		{
+			std::string childName = GetElementName(child);
+
+			if (childName.compare("parameterGroup") == 0)
+			{
+				childGroups.push_back(child);
+			}
+			else if (childName.compare("parameterRef") == 0)
+			{
+				parameterGroup.parameterRefResult = CliResult();
+				if (GetAttributeRow(child, kFormatStrChildParameterRefXpathExpression, row))
+				{
+					parameterGroup.parameterRefs.push_back(row);
+				}
+			}
+		}
+
+		/** Pushed in reverse so that the groups are visited in document order */
+		for (std::vector<const xercesc::DOMNode*>::const_reverse_iterator it = childGroups.rbegin(); it != childGroups.rend(); ++it)
+		{
+			groupStack.push_back(std::make_pair(*it, parameterGroup.attributes.at(0)));
+		}
+
+		deviceTemplate.parameterGroups.push_back(parameterGroup);
+		AddUniqueId(parameterGroup.attributes.at(0), XdcUniqueIdKind::PARAMETER_GROUP,
+		            deviceTemplate.parameterGroups.size() - 1, deviceTemplate);
+	}
+}
+
+void DeviceTemplateParser::AddUniqueId(const std::string& uniqueId,
+                                       const XdcUniqueIdKind kind,
+                                       const std::size_t position,
+                                       DeviceTemplate& deviceTemplate)
+{
+	if (uniqueId.empty())
+	{
+		return;
+	}
+
+	/** uniqueIDs are unique within an XDC, a duplicate keeps the first element */
+	deviceTemplate.uniqueIds.insert(std::make_pair(uniqueId, XdcUniqueIdType(kind, position)));
+}
+
+void DeviceTemplateParser::ExtractObjectList(const xercesc::DOMNode* node,
+        DeviceTemplate& deviceTemplate)
+{
+	std::vector<const xercesc::DOMNode*> objectNodes;
+	for (const xercesc::DOMNode* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+	{
+		if (GetElementName(child).compare("Object") == 0)
+		{
+			objectNodes.push_back(child);
+		}
+	}
+
+	if (objectNodes.empty())
+	{
+		return;
+	}
+	deviceTemplate.objectResult = CliResult();
+
+	/** Small lists are not worth the threads, the calling thread extracts the first chunk */
+	std::size_t chunkCount = std::min<std::size_t>(OpenConfiguratorCli::GetInstance().jobCount,
+	                         objectNodes.size() / kObjectChunkSize);
+	if (chunkCount > 1)
+	{
+		/** Busy prefetch workers leave no threads for the chunks */
+		chunkCount = ReserveThreads(chunkCount - 1) + 1;
+	}
+	if (chunkCount <= 1)
+	{
+		ExtractObjects(objectNodes, 0, objectNodes.size(), deviceTemplate.objects);
+		return;
+	}
+
+	/** The DOM is only read, each chunk is extracted into a buffer of its own */
+	std::vector<std::vector<XdcObjectType> > chunkObjects(chunkCount);
+	std::vector<std::exception_ptr> chunkErrors(chunkCount);
+	std::vector<std::thread> workers;
+	std::vector<std::size_t> inlineChunks(1, 0);
+
+	for (std::size_t chunk = 1; chunk < chunkCount; chunk++)
+	{
+		try
+		{
+			workers.push_back(std::thread(&DeviceTemplateParser::ExtractObjectChunk, this,
+			                              std::cref(objectNodes),
+			                              (objectNodes.size() * chunk) / chunkCount,
+			                              (objectNodes.size() * (chunk + 1)) / chunkCount,
+			                              std::ref(chunkObjects.at(chunk)),
+			                              std::ref(chunkErrors.at(chunk))));
+		}
+		catch (const std::system_error&)
+		{
+			/** Chunks without a thread are extracted by the calling thread */
+			inlineChunks.push_back(chunk);
+		}
+	}
+
+	for (std::size_t chunk : inlineChunks)
+	{
+		ExtractObjectChunk(objectNodes,
+		                   (objectNodes.size() * chunk) / chunkCount,
+		                   (objectNodes.size() * (chunk + 1)) / chunkCount,
+		                   chunkObjects.at(chunk), chunkErrors.at(chunk));
+	}
+
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+	ReleaseThreads(chunkCount - 1);
+
+	for (const std::exception_ptr& error : chunkErrors)
+	{
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+
+	/** Merge the buffers in document order */
+	deviceTemplate.objects.reserve(deviceTemplate.objects.size() + objectNodes.size());
+	for (std::vector<XdcObjectType>& objects : chunkObjects)
+	{
+		for (XdcObjectType& object : objects)
+		{
+			deviceTemplate.objects.push_back(std::move(object));
+		}
+	}
+}
+
+void DeviceTemplateParser::ExtractObjectChunk(const std::vector<const xercesc::DOMNode*>& objectNodes,
+        const std::size_t begin,
+        const std::size_t end,
+        std::vector<XdcObjectType>& objects,
+        std::exception_ptr& error)
+{
+	try
+	{
+		ExtractObjects(objectNodes, begin, end, objects);
+	}
+	catch (...)
+	{
+		error = std::current_exception();
+	}
+}
+
+void DeviceTemplateParser::ExtractObjects(const std::vector<const xercesc::DOMNode*>& objectNodes,
+        const std::size_t begin,
+        const std::size_t end,
+        std::vector<XdcObjectType>& objects)
+{
+	objects.reserve(objects.size() + (end - begin));
+	for (std::size_t index = begin; index < end; index++)
+	{
+		ExtractObject(objectNodes.at(index), objects);
+	}
+}
+
+void DeviceTemplateParser::ExtractObject(const xercesc::DOMNode* node,
+        std::vector<XdcObjectType>& objects)
+{
+	XdcObjectType object;
+
+	if (!ExtractObjectEntry(node, kObjectFields, objectAttributeNames, object.entry))
+	{
+		return;
+	}
+
+	bool subObjectFound = false;
+	XdcObjectEntryType subObject;
+
+	for (const xercesc::DOMNode* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+	{
+		if (GetElementName(child).compare("SubObject") == 0)
+		{
+			subObjectFound = true;
+			if (ExtractObjectEntry(child, kSubObjectFields, subObjectAttributeNames, subObject))
+			{
+				object.subObjects.push_back(subObject);
+			}
+		}
+	}
+
+	if (!subObjectFound)
+	{
+		object.subObjectResult = GetNoResult(kSubObjectXpathExpression);
+	}
+
+	objects.push_back(object);
+}
+
+bool DeviceTemplateParser::ExtractObjectEntry(const xercesc::DOMNode* node,
+        const XdcObjectFieldType* fields,
+        const std::vector<std::basic_string<XMLCh> >& attributeNames,
+        XdcObjectEntryType& entry)
+{
+	std::vector<std::string> row;
+	if (!ParserResult::GetAttributeValues(node, attributeNames, row))
+	{
+		return false;
+	}
+
+	entry = XdcObjectEntryType();
+	for (std::size_t column = 0; column < row.size(); column++)
+	{
+		/** An invalid value is reported when the entry is created */
+		entry.conversionResult = SetObjectField(fields[column].field, row[column], entry);
+		if (!entry.conversionResult.IsSuccessful())
+		{
+			return true;
+		}
+	}
+
+	/** Read only and constant entries do not take an actual value */
+	if ((entry.accessType == AccessType::RO) || (entry.accessType == AccessType::CONST))
+	{
+		entry.actualValue = "";
+	}
+
+	return true;
+}
+
+CliResult DeviceTemplateParser::SetObjectField(const XdcObjectField field,
+        const std::string& value,
+        XdcObjectEntryType& entry)
+{
+	switch (field)
+	{
+		case XdcObjectField::INDEX:
+			entry.indexValue = value;
+			if (!NumberConverter::ToUInt32(value, 16, entry.index))
+			{
+				return NumberConverter::GetConversionError(value);
+			}
+			break;
+		case XdcObjectField::NAME:
+			entry.name = value;
+			break;
+		case XdcObjectField::OBJECT_TYPE:
+		{
+			std::uint8_t objectType = 0;
+			if (!NumberConverter::ToUInt8(value, 10, objectType))
+			{
+				return NumberConverter::GetConversionError(value);
+			}
+			entry.objectType = ObjectType(objectType);
+			break;
+		}
+		case XdcObjectField::DEFAULT_VALUE:
+			entry.defaultValue = value;
+			break;
+		case XdcObjectField::DATA_TYPE:
+		{
+			std::uint32_t dataType = 0;
+			if (!NumberConverter::ToUInt32(value, 16, dataType))
+			{
+				return NumberConverter::GetConversionError(value);
+			}
+			entry.hasDataType = !value.empty();
+			entry.dataType = (PlkDataType) dataType;
+			break;
+		}
+		case XdcObjectField::ACCESS_TYPE:
+			if (!EnumConverter::ToAccessType(value, entry.accessType))
+			{
+				return NumberConverter::GetConversionError(value);
+			}
+			break;
+		case XdcObjectField::PDO_MAPPING:
+			if (!EnumConverter::ToPdoMapping(value, entry.pdoMapping))
+			{
+				return NumberConverter::GetConversionError(value);
+			}
+			break;
+		case XdcObjectField::ACTUAL_VALUE:
+			entry.actualValue = value;
+			break;
+		case XdcObjectField::UNIQUE_ID_REF:
+			entry.uniqueIdRef = value;
+			break;
+		case XdcObjectField::LOW_LIMIT:
+			entry.lowLimit = value;
+			break;
+		case XdcObjectField::HIGH_LIMIT:
+			entry.highLimit = value;
+			break;
+		case XdcObjectField::RANGE_SELECTOR:
+			entry.rangeSelector = value;
+			break;
+		default:
+			break;
+	}
+
+	return CliResult();
+}
+
+void DeviceTemplateParser::ExtractAppLayerInterface(const xercesc::DOMNode* node,
+        DeviceTemplate& deviceTemplate)
+{
+	XdcAppLayerInterfaceType appLayerInterface;
+
+	if (!GetAttributeRow(node, kFormatStrAppLayerInterfaceXpathExpression, appLayerInterface.attributes))
+	{
+		return;
+	}
+
+	appLayerInterface.rangeResult = GetNoResult(kInterfaceRangeXpathExpression);
+
+	for (const xercesc::DOMNode* rangeList = node->getFirstChild(); rangeList != NULL; rangeList = rangeList->getNextSibling())
+	{
+		if (GetElementName(rangeList).compare("rangeList") == 0)
+		{
+			CliResult res = ExtractChildRows(rangeList, "range", kInterfaceRangeXpathExpression,
+			                                 kFormatStrInterfaceRangeXpathExpression,
+			                                 appLayerInterface.ranges);
+			if (res.IsSuccessful())
+			{
+				appLayerInterface.rangeResult = res;
+			}
+		}
+	}
+
+	deviceTemplate.appLayerInterfaces.push_back(appLayerInterface);
+}
+
+CliResult DeviceTemplateParser::ExtractChildRows(const xercesc::DOMNode* node,
+        const std::string& childName,
+        const std::string& xPathExpression,
+        const std::string& formatString,
+        std::vector<std::vector<std::string> >& rows)
+{
+	bool childFound = false;
+	std::vector<std::string> row;
+
+	for (const xercesc::DOMNode* child = node->getFirstChild(); child != NULL; child = child->getNextSibling())
+	{
+		if (GetElementName(child).compare(childName) == 0)
+		{
+			childFound = true;
+			if (GetAttributeRow(child, formatString, row))
+			{
+				rows.push_back(row);
+			}
+		}
+	}
+
+	if (!childFound)
+	{
+		return GetNoResult(xPathExpression);
+	}
+
+	return CliResult();
+}
+
+bool DeviceTemplateParser::GetAttributeRow(const xercesc::DOMNode* node,
+        const std::string& formatString,
+        std::vector<std::string>& row)
+{
+	/** Like ParserResult, nodes without attributes do not produce a row */
+	return ParserResult::GetAttributeValues(node, attributeNameMap.at(formatString), row);
+}
+
+std::string DeviceTemplateParser::GetElementName(const xercesc::DOMNode* node)
+{
+	if (node->getNodeType() != xercesc::DOMNode::ELEMENT_NODE)
+	{
+		return "";
+	}
+
+	const XMLCh* name = node->getLocalName();
+	if (name == NULL)
+	{
+		name = node->getNodeName();
+	}
+
+	char* elementName = xercesc::XMLString::transcode(name);
+	std::string nameString = elementName;
+	xercesc::XMLString::release(&elementName);
+
+	return nameString;
+}
+
+CliResult DeviceTemplateParser::GetNoResult(const std::string& xPathExpression)
+{
+	boost::format formatter(kMsgNoResultForXPath[CliLogger::GetInstance().languageIndex]);
+	formatter % xPathExpression;
+
+	return CliResult(CliErrorCode::NO_RESULT_FOR_XPATH, formatter.str());
+}
+
+IEC_Datatype DeviceTemplateParser::GetDataType(const std::string& dataType)
+{
+	IEC_Datatype data = IEC_Datatype::UNDEFINED;
+	EnumConverter::ToIecDataType(dataType, data);
+	return data;
+}
+
+IEC_Datatype DeviceTemplateParser::GetIecDataType(const xercesc::DOMNode* node)
+{
+	IEC_Datatype data = IEC_Datatype::UNDEFINED;
+
+	try
+	{
+		if (node->hasChildNodes())
+		{
+			xercesc::DOMNodeList* childNode = node->getChildNodes();
+			const XMLSize_t nodeCount = childNode->getLength();
+
+			for (XMLSize_t index = 0; index < nodeCount; index++)
+			{
+				xercesc::DOMNode* currentNode = childNode->item(index);
+
+				if ((currentNode->getNodeType()) && (currentNode->getNodeType() == xercesc::DOMNode::ELEMENT_NODE))
+				{
+					char* subNodeName = xercesc::XMLString::transcode(currentNode->getNodeName());
+					std::string childNodeName = subNodeName;
+
+					xercesc::XMLString::release(&subNodeName);
+
+					if ((childNodeName.compare("defaultValue") == 0) ||
+					        (childNodeName.compare("allowedValues") == 0) ||
+					        (childNodeName.compare("actualValue") == 0) ||
+					        (childNodeName.compare("substituteValue") == 0) ||
+					        (childNodeName.compare("unit") == 0) ||
+					        (childNodeName.compare("property") == 0))
+					{
+						return data;
+					}
+
+					data = GetDataType(childNodeName);
+				}
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		CliResult res = CliLogger::GetInstance().GetFailureErrorString(e);
+
+		LOG_ERROR() << res.GetErrorMessage();
+
+		return IEC_Datatype::UNDEFINED;
+	}
+
+	return data;
+}
@@ -0,0 +1,211 @@
+/**
+ * \file EnumConverter.cpp
+ *
+ * \brief Implementation of EnumConverter module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "EnumConverter.h"
+
+using namespace IndustrialNetwork::POWERLINK::Core::ObjectDictionary;
+using namespace IndustrialNetwork::POWERLINK::Core::ModularNode;
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+/**
+  * The tables below are generated offline: the seed of each table is chosen
+  * so that GetSlot maps every name to a different slot. A name that is added
+  * to a table requires a new seed and slot order.
+  */
+
+/** Perfect hash table of the IEC data types */
+const std::uint32_t kIecDataTypeTableSeed = 87738;
+const EnumEntryType<IEC_Datatype> kIecDataTypeTable[26] =
+{
+	{"", IEC_Datatype::UNDEFINED},
+	{"UNDEFINED", IEC_Datatype::UNDEFINED},
+	{"CHAR", IEC_Datatype::_CHAR},
+	{"ULINT", IEC_Datatype::ULINT},
+	{NULL, IEC_Datatype::UNDEFINED},
+	{"DWORD", IEC_Datatype::DWORD},
+	{"BYTE", IEC_Datatype::BYTE},
+	{"INT", IEC_Datatype::INT},
+	{NULL, IEC_Datatype::UNDEFINED},
+	{NULL, IEC_Datatype::UNDEFINED},
+	{"REAL", IEC_Datatype::REAL},
+	{"BITSTRING", IEC_Datatype::BITSTRING},
+	{"STRING", IEC_Datatype::STRING},
+	{"LWORD", IEC_Datatype::LWORD},
+	{"DINT", IEC_Datatype::DINT},
+	{NULL, IEC_Datatype::UNDEFINED},
+	{"SINT", IEC_Datatype::SINT},
+	{"UDINT", IEC_Datatype::UDINT},
+	{"UINT", IEC_Datatype::UINT},
+	{"LREAL", IEC_Datatype::LREAL},
+	{"WORD", IEC_Datatype::WORD},
+	{"WSTRING", IEC_Datatype::WSTRING},
+	{"LINT", IEC_Datatype::LINT},
+	{"USINT", IEC_Datatype::USINT},
+	{"BOOL", IEC_Datatype::BOOL},
+	{NULL, IEC_Datatype::UNDEFINED}
+};
+
+/** Perfect hash table of the parameter access values */
+const std::uint32_t kParameterAccessTableSeed = 1252;
+const EnumEntryType<ParameterAccess> kParameterAccessTable[9] =
+{
+	{"", ParameterAccess::undefined},
+	{"noAccess", ParameterAccess::noAccess},
+	{"write", ParameterAccess::write},
+	{"undefined", ParameterAccess::undefined},
+	{"read", ParameterAccess::read},
+	{"constant", ParameterAccess::constant},
+	{"readWrite", ParameterAccess::readWrite},
+	{"readWriteInput", ParameterAccess::readWriteInput},
+	{"readWriteOutput", ParameterAccess::readWriteOutput}
+};
+
+/** Perfect hash table of the object access types */
+const std::uint32_t kAccessTypeTableSeed = 1529;
+const EnumEntryType<AccessType> kAccessTypeTable[9] =
+{
+	{"", AccessType::UNDEFINED},
+	{"wo", AccessType::WO},
+	{"undefined", AccessType::UNDEFINED},
+	{"const", AccessType::CONST},
+	{"wos", AccessType::WOS},
+	{"rw", AccessType::RW},
+	{"ro", AccessType::RO},
+	{"cond", AccessType::COND},
+	{"rws", AccessType::RWS}
+};
+
+/** Perfect hash table of the PDO mappings */
+const std::uint32_t kPdoMappingTableSeed = 442;
+const EnumEntryType<PDOMapping> kPdoMappingTable[7] =
+{
+	{"", PDOMapping::UNDEFINED},
+	{"default", PDOMapping::DEFAULT},
+	{"optional", PDOMapping::OPTIONAL},
+	{"RPDO", PDOMapping::RPDO},
+	{"no", PDOMapping::NO},
+	{"TPDO", PDOMapping::TPDO},
+	{"undefined", PDOMapping::UNDEFINED}
+};
+
+/** Perfect hash table of the dynamic channel access types */
+const std::uint32_t kDynamicChannelAccessTypeTableSeed = 1;
+const EnumEntryType<DynamicChannelAccessType> kDynamicChannelAccessTypeTable[3] =
+{
+	{"writeOnly", DynamicChannelAccessType::writeOnly},
+	{"readWriteOutput", DynamicChannelAccessType::readWriteOutput},
+	{"readOnly", DynamicChannelAccessType::readOnly}
+};
+
+/** Perfect hash table of the module addressing values */
+const std::uint32_t kModuleAddressingTableSeed = 3;
+const EnumEntryType<ModuleAddressing> kModuleAddressingTable[3] =
+{
+	{"manual", ModuleAddressing::MANUAL},
+	{"next", ModuleAddressing::NEXT},
+	{"position", ModuleAddressing::POSITION}
+};
+
+/** Perfect hash table of the sort numbers */
+const std::uint32_t kSortNumberTableSeed = 2;
+const EnumEntryType<SortNumber> kSortNumberTable[2] =
+{
+	{"continuous", SortNumber::CONTINUOUS},
+	{"address", SortNumber::ADDRESS}
+};
+
+/** Perfect hash table of the sort modes */
+const std::uint32_t kSortModeTableSeed = 2;
+const EnumEntryType<SortMode> kSortModeTable[2] =
+{
+	{"subindex", SortMode::SUBINDEX},
+	{"index", SortMode::INDEX}
+};
+bool EnumConverter::ToIecDataType(const std::string& value, IEC_Datatype& result)
+{
+	return Find(value, kIecDataTypeTable, kIecDataTypeTableSeed, result);
+}
+
+bool EnumConverter::ToParameterAccess(const std::string& value, ParameterAccess& result)
+{
+	return Find(value, kParameterAccessTable, kParameterAccessTableSeed, result);
+}
+
+bool EnumConverter::ToAccessType(const std::string& value, AccessType& result)
+{
+	return Find(value, kAccessTypeTable, kAccessTypeTableSeed, result);
+}
+
+bool EnumConverter::ToPdoMapping(const std::string& value, PDOMapping& result)
+{
+	return Find(value, kPdoMappingTable, kPdoMappingTableSeed, result);
+}
+
+bool EnumConverter::ToDynamicChannelAccessType(const std::string& value, DynamicChannelAccessType& result)
+{
+	return Find(value, kDynamicChannelAccessTypeTable, kDynamicChannelAccessTypeTableSeed, result);
+}
+
+bool EnumConverter::ToModuleAddressing(const std::string& value, ModuleAddressing& result)
+{
+	return Find(value, kModuleAddressingTable, kModuleAddressingTableSeed, result);
+}
+
+bool EnumConverter::ToSortNumber(const std::string& value, SortNumber& result)
+{
+	return Find(value, kSortNumberTable, kSortNumberTableSeed, result);
+}
+
+bool EnumConverter::ToSortMode(const std::string& value, SortMode& result)
+{
+	return Find(value, kSortModeTable, kSortModeTableSeed, result);
+}
+
+std::size_t EnumConverter::GetSlot(const std::string& value,
+                                   const std::uint32_t seed,
+                                   const std::size_t slotCount)
+{
+	const std::size_t length = value.size();
+	const std::uint32_t first = (length > 0) ? (std::uint8_t) value[0] : 0U;
+	const std::uint32_t second = (length > 1) ? (std::uint8_t) value[1] : 0U;
+	const std::uint32_t last = (length > 0) ? (std::uint8_t) value[length - 1] : 0U;
+
+	/** Unsigned 32 bit arithmetic, wraps around like in the generator */
+	std::uint32_t hash = (std::uint32_t) length;
+	hash += first * seed;
+	hash += second * seed * seed;
+	hash += last * seed * seed * seed;
+
+	return hash % slotCount;
+}
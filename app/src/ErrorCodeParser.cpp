@@ -76,7 +76,7 @@ CliResult ErrorCodeParser::ParseErrorCodeTable(const std::string& xmlFilePath)
 		return ceres;
 	}
 
-	ParserElement xmlElement(xmlFilePath, kErrCodeXmlSchemaDefinitionFileName, kErrCodeNamespace);
+	ParserElement xmlElement(xmlFilePath, kErrCodeXmlSchemaDefinitionFileName, kErrCodeNamespace, false);
 
 	ceres = xmlElement.CreateElement();
 	if (!ceres.IsSuccessful())
@@ -0,0 +1,145 @@
+/**
+ * \file GrammarPool.cpp
+ *
+ * \brief Implementation of GrammarPool module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#include "GrammarPool.h"
+#include "ParameterValidator.h"
+#include "ParserErrorHandler.h"
+
+using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+GrammarPool::GrammarPool() :
+	grammarPool(NULL),
+	loadedSchemaFiles(),
+	poolLocked(false),
+	poolMutex()
+{
+	/** Keep Xerces initialized as long as the compiled grammars are alive */
+	xercesc::XMLPlatformUtils::Initialize();
+
+	grammarPool = new xercesc::XMLGrammarPoolImpl(xercesc::XMLPlatformUtils::fgMemoryManager);
+}
+
+GrammarPool::~GrammarPool()
+{
+	/** Release the compiled grammars */
+	delete grammarPool;
+
+	/** Release the Xerces usage */
+	xercesc::XMLPlatformUtils::Terminate();
+}
+
+GrammarPool& GrammarPool::GetInstance()
+{
+	static GrammarPool instance;
+
+	return instance;
+}
+
+xercesc::XMLGrammarPool* GrammarPool::GetPool()
+{
+	return grammarPool;
+}
+
+void GrammarPool::LockPool()
+{
+	std::lock_guard<std::mutex> lock(poolMutex);
+
+	/** A locked pool uses a synchronized string pool for the parsers */
+	grammarPool->lockPool();
+	poolLocked = true;
+}
+
+void GrammarPool::UnlockPool()
+{
+	std::lock_guard<std::mutex> lock(poolMutex);
+
+	grammarPool->unlockPool();
+	poolLocked = false;
+}
+
+CliResult GrammarPool::LoadGrammar(const std::string& schemaFile)
+{
+	try
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+
+		std::string schemaPath = boost::filesystem::absolute(schemaFile).string();
+		if (loadedSchemaFiles.find(schemaPath) != loadedSchemaFiles.end())
+		{
+			return CliResult();
+		}
+
+		/** A locked pool does not accept new grammars */
+		if (poolLocked)
+		{
+			return CliResult(CliErrorCode::ERROR_LOADING_GRAMMER,
+			                 kMsgErrorLoadingGrammer[CliLogger::GetInstance().languageIndex]);
+		}
+
+		/** Validate for the schema file existance */
+		CliResult res = ParameterValidator::GetInstance().IsFileExists(schemaFile);
+		if (!res.IsSuccessful())
+		{
+			return res;
+		}
+
+		/** Compile the schema with the same checks as a validating parse,
+		    full constraint checking of the schema is skipped below full level */
+		xercesc::XercesDOMParser grammarParser(NULL, xercesc::XMLPlatformUtils::fgMemoryManager, grammarPool);
+		grammarParser.setDoNamespaces(true);
+		grammarParser.setDoSchema(true);
+		grammarParser.setValidationSchemaFullChecking(OpenConfiguratorCli::GetInstance().validationLevel == ValidationLevel::FULL);
+
+		ParserErrorHandler parserErrorHandler;
+		grammarParser.setErrorHandler(&parserErrorHandler);
+
+		if ((grammarParser.loadGrammar(schemaPath.c_str(),
+		                               xercesc::Grammar::SchemaGrammarType, true) == NULL)
+		        || (grammarParser.getErrorCount() != 0))
+		{
+			return CliResult(CliErrorCode::ERROR_LOADING_GRAMMER,
+			                 kMsgErrorLoadingGrammer[CliLogger::GetInstance().languageIndex]);
+		}
+
+		loadedSchemaFiles.insert(schemaPath);
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
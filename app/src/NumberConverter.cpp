@@ -0,0 +1,171 @@
+/**
+ * \file NumberConverter.cpp
+ *
+ * \brief Implementation of NumberConverter module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#include "NumberConverter.h"
+#include "CliLogger.h"
+
+using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+/** Marks characters that are not a digit in the digit table */
+const std::uint8_t kNoDigit = 0xFF;
+
+/** Digit values of the characters '0'-'9', 'a'-'f' and 'A'-'F', independent of the locale */
+const std::uint8_t kDigitTable[256] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+bool NumberConverter::ToUInt32(const std::string& value,
+                               const std::uint8_t base,
+                               std::uint32_t& result)
+{
+	if (value.empty())
+	{
+		return true;
+	}
+
+	std::uint64_t number = 0;
+	if (!ToNumber(value, base, 0xFFFFFFFFULL, number))
+	{
+		return false;
+	}
+
+	result = (std::uint32_t) number;
+	return true;
+}
+
+bool NumberConverter::ToUInt8(const std::string& value,
+                              const std::uint8_t base,
+                              std::uint8_t& result)
+{
+	if (value.empty())
+	{
+		return true;
+	}
+
+	std::uint64_t number = 0;
+	if (!ToNumber(value, base, 0xFFFFFFFFULL, number))
+	{
+		return false;
+	}
+
+	/** Truncated like the casts of the former std::stoi conversions */
+	result = (std::uint8_t) number;
+	return true;
+}
+
+CliResult NumberConverter::GetConversionError(const std::string& value)
+{
+	boost::format formatter(kMsgInvalidValue[CliLogger::GetInstance().languageIndex]);
+	formatter % value;
+
+	return CliResult(CliErrorCode::INVALID_PARAMETERS, formatter.str());
+}
+
+bool NumberConverter::ToNumber(const std::string& value,
+                               const std::uint8_t base,
+                               const std::uint64_t maxValue,
+                               std::uint64_t& result)
+{
+	std::size_t pos = 0;
+	std::size_t end = value.size();
+
+	/** Surrounding white space is accepted like in std::stol */
+	while ((pos < end) && IsXmlWhitespace(value[pos]))
+	{
+		pos++;
+	}
+	while ((end > pos) && IsXmlWhitespace(value[end - 1]))
+	{
+		end--;
+	}
+
+	/** An explicit sign is accepted like in std::stol and the schema integer types */
+	if ((pos < end) && (value[pos] == '+'))
+	{
+		pos++;
+	}
+
+	if ((base == 16) && (end - pos > 2) && (value[pos] == '0')
+	        && ((value[pos + 1] == 'x') || (value[pos + 1] == 'X')))
+	{
+		pos += 2;
+	}
+
+	if (pos == end)
+	{
+		return false;
+	}
+
+	std::uint64_t number = 0;
+	for (; pos < end; pos++)
+	{
+		std::uint8_t digit = kDigitTable[(std::uint8_t) value[pos]];
+		if ((digit == kNoDigit) || (digit >= base))
+		{
+			return false;
+		}
+
+		number = (number * base) + digit;
+		if (number > maxValue)
+		{
+			return false;
+		}
+	}
+
+	result = number;
+	return true;
+}
+
+bool NumberConverter::IsXmlWhitespace(const char character)
+{
+	return ((character == ' ') || (character == '\t') || (character == '\n') || (character == '\r'));
+}
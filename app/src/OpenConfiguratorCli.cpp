@@ -49,7 +49,11 @@ using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
 OpenConfiguratorCli::OpenConfiguratorCli() :
 	xmlFilePath(""),
 	outputPath(""),
-	networkName("")
+	networkName(""),
+	jobCount(1),
+	validationLevel(ValidationLevel::FULL),
+	validationCacheDirectory(""),
+	syncOutputFiles(false)
 {
 }
 
@@ -148,6 +152,38 @@ CliResult OpenConfiguratorCli::GenerateConfigurationFiles(const std::vector<std:
 				}
 			}
 
+			std::string jobCountValue;
+			if (!GetJobCount(paramsList, jobCountValue))
+			{
+				ShowUsage();
+
+				boost::format formatter(kMsgInvalidJobCount[CliLogger::GetInstance().languageIndex]);
+				formatter % jobCountValue;
+
+				return CliResult(CliErrorCode::INVALID_PARAMETERS, formatter.str());
+			}
+
+			std::string validationLevelValue;
+			if (!GetValidationLevel(paramsList, validationLevelValue))
+			{
+				ShowUsage();
+
+				boost::format formatter(kMsgInvalidValidationLevel[CliLogger::GetInstance().languageIndex]);
+				formatter % validationLevelValue;
+
+				return CliResult(CliErrorCode::INVALID_PARAMETERS, formatter.str());
+			}
+
+			if (!GetValidationCacheDirectory(paramsList))
+			{
+				ShowUsage();
+
+				return CliResult(CliErrorCode::INVALID_PARAMETERS,
+				                 kMsgValidationCacheDirectoryNotFound[CliLogger::GetInstance().languageIndex]);
+			}
+
+			syncOutputFiles = IsSyncOutput(paramsList);
+
 			/** Parse and Generate configuration output */
 			res = ConfigurationGenerator::GetInstance().GenerateOutputFiles(xmlFilePath, outputPath);
 			if (!res.IsSuccessful())
@@ -189,6 +225,10 @@ void OpenConfiguratorCli::ShowUsage()
 	const std::string kMsgOutputParameter   = " -o,--output <OutputPath> \t Output path for generated files. ";
 	const std::string kMsgLanguageParameter = " -de,--german \t\t\t German log messages. Default is English.";
 	const std::string kMsgLogMessage        = " -d,--debug \t\t\t Log on file. Default logging is on console.";
+	const std::string kMsgJobsParameter     = " -j,--jobs <N> \t\t Number of threads reading the XDC files. Default is 1.";
+	const std::string kMsgValidateParameter = " --validate=<level> \t\t Validation of the input files: full, fast or trusted. Default is full.";
+	const std::string kMsgCacheParameter    = " --validation-cache <Dir> \t Cache of the trusted validation. Default is ./validation_cache.";
+	const std::string kMsgFsyncParameter    = " --fsync \t\t\t Flush each output file to disk before it replaces the previous one.";
 	const std::string kMsgHelpParameter     = " -h,--help \t\t\t Help. ";
 
 	std::cout << "openCONFIGURATOR " << kMsgVersion << std::endl;
@@ -200,6 +240,10 @@ void OpenConfiguratorCli::ShowUsage()
 	std::cout << kMsgOutputParameter << std::endl;
 	std::cout << kMsgLanguageParameter << std::endl;
 	std::cout << kMsgLogMessage << std::endl;
+	std::cout << kMsgJobsParameter << std::endl;
+	std::cout << kMsgValidateParameter << std::endl;
+	std::cout << kMsgCacheParameter << std::endl;
+	std::cout << kMsgFsyncParameter << std::endl;
 	std::cout << kMsgHelpParameter << std::endl;
 }
 
@@ -296,6 +340,145 @@ bool OpenConfiguratorCli::IsLogDebug(const std::vector<std::string>& paramsList)
 	return false;
 }
 
+bool OpenConfiguratorCli::IsSyncOutput(const std::vector<std::string>& paramsList)
+{
+	for (std::size_t index = 0; index < paramsList.size(); index++)
+	{
+		/** Search for fsync option */
+		if (paramsList.at(index).compare("--fsync") == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool OpenConfiguratorCli::GetJobCount(const std::vector<std::string>& paramsList, std::string& jobCountValue)
+{
+	jobCount = 1;
+
+	for (std::size_t index = 0; index < paramsList.size(); index++)
+	{
+		/** Search for jobs option */
+		if ((paramsList.at(index).compare("-j") == 0)  || (paramsList.at(index).compare("--jobs") == 0))
+		{
+			/* Check whether next element exists against number of parameters */
+			std::size_t increment = 1;
+			if ((index + increment) >= paramsList.size())
+			{
+				return false;
+			}
+
+			jobCountValue = paramsList.at(index + 1);
+			if (jobCountValue.empty()
+			        || (jobCountValue.find_first_not_of("0123456789") != std::string::npos)
+			        || (jobCountValue.size() > 4))
+			{
+				return false;
+			}
+
+			jobCount = (std::uint32_t)std::stoul(jobCountValue);
+			if (jobCount == 0)
+			{
+				return false;
+			}
+
+			break;
+		}
+	}
+
+	return true;
+}
+
+bool OpenConfiguratorCli::GetValidationCacheDirectory(const std::vector<std::string>& paramsList)
+{
+	const std::string kValidationCacheOption = "--validation-cache";
+
+	/** The cache is kept in the working directory unless another directory is given */
+	validationCacheDirectory = kValidationCacheDirectory;
+
+	for (std::size_t index = 0; index < paramsList.size(); index++)
+	{
+		/** Search for validation cache option, the directory follows after '=' or as next parameter */
+		if (paramsList.at(index).compare(0, kValidationCacheOption.size() + 1, kValidationCacheOption + "=") == 0)
+		{
+			validationCacheDirectory = paramsList.at(index).substr(kValidationCacheOption.size() + 1);
+		}
+		else if (paramsList.at(index).compare(kValidationCacheOption) == 0)
+		{
+			/* Check whether next element exists against number of parameters */
+			std::size_t increment = 1;
+			if ((index + increment) >= paramsList.size())
+			{
+				return false;
+			}
+
+			validationCacheDirectory = paramsList.at(index + 1);
+		}
+		else
+		{
+			continue;
+		}
+
+		return !validationCacheDirectory.empty();
+	}
+
+	return true;
+}
+
+bool OpenConfiguratorCli::GetValidationLevel(const std::vector<std::string>& paramsList, std::string& levelValue)
+{
+	const std::string kValidateOption = "--validate";
+
+	validationLevel = ValidationLevel::FULL;
+
+	for (std::size_t index = 0; index < paramsList.size(); index++)
+	{
+		/** Search for validate option, the level follows after '=' or as next parameter */
+		if (paramsList.at(index).compare(0, kValidateOption.size() + 1, kValidateOption + "=") == 0)
+		{
+			levelValue = paramsList.at(index).substr(kValidateOption.size() + 1);
+		}
+		else if (paramsList.at(index).compare(kValidateOption) == 0)
+		{
+			/* Check whether next element exists against number of parameters */
+			std::size_t increment = 1;
+			if ((index + increment) >= paramsList.size())
+			{
+				return false;
+			}
+
+			levelValue = paramsList.at(index + 1);
+		}
+		else
+		{
+			continue;
+		}
+
+		if (levelValue.compare("full") == 0)
+		{
+			validationLevel = ValidationLevel::FULL;
+		}
+		else if (levelValue.compare("fast") == 0)
+		{
+			validationLevel = ValidationLevel::FAST;
+		}
+		else if (levelValue.compare("trusted") == 0)
+		{
+			validationLevel = ValidationLevel::TRUSTED;
+		}
+		else
+		{
+			return false;
+		}
+
+		break;
+	}
+
+	return true;
+}
+
 bool OpenConfiguratorCli::GetHelpOption(const std::vector<std::string>& paramsList)
 {
 	for (std::size_t index = 0; index < paramsList.size(); index++)
@@ -0,0 +1,385 @@
+/**
+ * \file OutputFileWriter.cpp
+ *
+ * \brief Implementation of OutputFileWriter module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "OutputFileWriter.h"
+
+#include <system_error>
+#include <set>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace IndustrialNetwork::POWERLINK::Application;
+using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
+
+/** Upper case hex digits indexed by nibble value */
+const char kHexDigits[] = "0123456789ABCDEF";
+
+/** Size of the chunks in which the hex text is written */
+const std::size_t kHexWriteChunkSize = 64 * 1024;
+
+/** Number of bytes per line of the hex text */
+const std::size_t kHexWordWrapLength = 16;
+
+/** Model of the temporary file name next to the target, unique per file and process */
+const std::string kTemporaryFileModel = ".%%%%-%%%%-%%%%-%%%%.tmp";
+
+OutputFile::OutputFile(const std::string& targetPath, const OutputFileFormat format) :
+	targetPath(targetPath),
+	format(format),
+	text(),
+	binary()
+{
+}
+
+OutputFile::~OutputFile()
+{
+}
+
+OutputFileWriter::OutputFileWriter(bool syncFiles) :
+	pendingFiles(),
+	writtenFiles(),
+	syncFiles(syncFiles),
+	finished(false),
+	failure(),
+	hasFailure(false),
+	workers(),
+	writerMutex(),
+	fileQueued()
+{
+}
+
+OutputFileWriter::~OutputFileWriter()
+{
+	Finish(false);
+}
+
+void OutputFileWriter::Start(std::uint32_t threadCount)
+{
+	for (std::uint32_t worker = 0; worker < threadCount; worker++)
+	{
+		try
+		{
+			workers.push_back(std::thread(&OutputFileWriter::Worker, this));
+		}
+		catch (const std::system_error&)
+		{
+			/** Files without a worker are written by Finish */
+			break;
+		}
+	}
+}
+
+void OutputFileWriter::Add(OutputFile& file)
+{
+	std::unique_ptr<OutputFile> queuedFile(new OutputFile(file.targetPath, file.format));
+	queuedFile->text.swap(file.text);
+	queuedFile->binary.swap(file.binary);
+
+	{
+		std::lock_guard<std::mutex> lock(writerMutex);
+		pendingFiles.push_back(std::move(queuedFile));
+	}
+
+	fileQueued.notify_one();
+}
+
+CliResult OutputFileWriter::Finish(bool commit)
+{
+	{
+		std::lock_guard<std::mutex> lock(writerMutex);
+		finished = true;
+	}
+	fileQueued.notify_all();
+
+	/** The calling thread helps with the remaining files */
+	std::unique_ptr<OutputFile> file;
+	while (TakeFile(false, file))
+	{
+		SetResult(WriteFile(*file));
+	}
+
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+	workers.clear();
+
+	/** The previous outputs are replaced only by a complete set of files */
+	if (commit && !hasFailure)
+	{
+		SetResult(CommitFiles());
+	}
+	DiscardFiles();
+
+	std::lock_guard<std::mutex> lock(writerMutex);
+	finished = false;
+
+	return failure;
+}
+
+void OutputFileWriter::Worker()
+{
+	std::unique_ptr<OutputFile> file;
+	while (TakeFile(true, file))
+	{
+		SetResult(WriteFile(*file));
+	}
+}
+
+bool OutputFileWriter::TakeFile(bool wait, std::unique_ptr<OutputFile>& file)
+{
+	std::unique_lock<std::mutex> lock(writerMutex);
+
+	while (wait && pendingFiles.empty() && !finished)
+	{
+		fileQueued.wait(lock);
+	}
+
+	if (pendingFiles.empty())
+	{
+		return false;
+	}
+
+	file = std::move(pendingFiles.front());
+	pendingFiles.pop_front();
+
+	return true;
+}
+
+CliResult OutputFileWriter::WriteFile(const OutputFile& file)
+{
+	try
+	{
+		boost::filesystem::path targetPath(file.targetPath);
+		std::string temporaryPath = (targetPath.parent_path()
+		                             / boost::filesystem::unique_path(targetPath.filename().string() + kTemporaryFileModel)).string();
+
+		/** Registered before it is created, a failed run removes it in any case */
+		{
+			std::lock_guard<std::mutex> lock(writerMutex);
+			writtenFiles.push_back(std::make_pair(temporaryPath, file.targetPath));
+		}
+
+		{
+			std::ios::openmode mode = std::ios::out;
+			if (file.format == OutputFileFormat::BINARY)
+			{
+				mode |= std::ios::binary;
+			}
+
+			std::ofstream ofile(temporaryPath.c_str(), mode);
+			if (ofile.is_open())
+			{
+				WriteContent(file, ofile);
+				ofile.close();
+			}
+
+			if (ofile.fail())
+			{
+				boost::format formatter(kMsgOutputFileNotWritten[CliLogger::GetInstance().languageIndex]);
+				formatter % file.targetPath;
+
+				return CliResult(CliErrorCode::FAILURE, formatter.str());
+			}
+		}
+
+		/** The content is on disk before the file appears under its name */
+		if (syncFiles && !SyncPath(temporaryPath, false))
+		{
+			boost::format formatter(kMsgOutputFileNotWritten[CliLogger::GetInstance().languageIndex]);
+			formatter % file.targetPath;
+
+			return CliResult(CliErrorCode::FAILURE, formatter.str());
+		}
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
+
+CliResult OutputFileWriter::CommitFiles()
+{
+	try
+	{
+		std::set<std::string> directories;
+
+		while (!writtenFiles.empty())
+		{
+			/** Replaces an existing target in one step */
+			boost::filesystem::rename(writtenFiles.front().first, writtenFiles.front().second);
+
+			if (syncFiles)
+			{
+				directories.insert(boost::filesystem::absolute(writtenFiles.front().second).parent_path().string());
+			}
+			writtenFiles.erase(writtenFiles.begin());
+		}
+
+		for (const std::string& directory : directories)
+		{
+			SyncPath(directory, true);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
+
+void OutputFileWriter::DiscardFiles()
+{
+	for (const std::pair<std::string, std::string>& writtenFile : writtenFiles)
+	{
+		boost::system::error_code errorCode;
+		boost::filesystem::remove(writtenFile.first, errorCode);
+	}
+	writtenFiles.clear();
+}
+
+void OutputFileWriter::WriteContent(const OutputFile& file, std::ofstream& stream)
+{
+	switch (file.format)
+	{
+		case OutputFileFormat::TEXT:
+			stream << file.text << std::endl;
+			break;
+		case OutputFileFormat::BINARY:
+			if (file.binary && !file.binary->empty())
+			{
+				stream.write(reinterpret_cast<const char*>(file.binary->data()), file.binary->size());
+			}
+			break;
+		case OutputFileFormat::HEX_TEXT:
+		{
+			/** Each byte is written as "0xNN", separated by ", " and 16 bytes per line */
+			std::string chunk;
+			chunk.reserve(kHexWriteChunkSize + 8);
+
+			std::size_t size = file.binary ? file.binary->size() : 0;
+			for (std::size_t cnt = 0; cnt < size; ++cnt)
+			{
+				std::uint8_t value = (*file.binary)[cnt];
+
+				chunk.push_back('0');
+				chunk.push_back('x');
+				chunk.push_back(kHexDigits[value >> 4]);
+				chunk.push_back(kHexDigits[value & 0x0F]);
+
+				if (cnt != (size - 1))
+				{
+					chunk.push_back(',');
+				}
+
+				if (((cnt + 1) % kHexWordWrapLength) == 0)
+				{
+					chunk.push_back('\n');
+				}
+				else
+				{
+					chunk.push_back(' ');
+				}
+
+				if (chunk.size() >= kHexWriteChunkSize)
+				{
+					stream.write(chunk.data(), chunk.size());
+					chunk.clear();
+				}
+			}
+
+			stream.write(chunk.data(), chunk.size());
+			stream << std::endl;
+			break;
+		}
+		default:
+			break;
+	}
+}
+
+bool OutputFileWriter::SyncPath(const std::string& path, bool isDirectory)
+{
+#ifdef _WIN32
+	/** Directory entries are flushed by the file system on Windows */
+	if (isDirectory)
+	{
+		return true;
+	}
+
+	int fd = _open(path.c_str(), _O_RDWR | _O_BINARY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	bool synced = (_commit(fd) == 0);
+	_close(fd);
+#else
+	int fd = open(path.c_str(), isDirectory ? (O_RDONLY | O_DIRECTORY) : O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	bool synced = (fsync(fd) == 0);
+	close(fd);
+#endif
+
+	return synced;
+}
+
+void OutputFileWriter::SetResult(const CliResult& result)
+{
+	CliResult res = result;
+	if (res.IsSuccessful())
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(writerMutex);
+	if (!hasFailure)
+	{
+		failure = result;
+		hasFailure = true;
+	}
+}
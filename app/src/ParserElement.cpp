@@ -35,34 +35,57 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ParserElement.h"
 #include "ParameterValidator.h"
+#include "GrammarPool.h"
+#include "ValidationCache.h"
 
 using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
 using namespace IndustrialNetwork::POWERLINK::Application;
 
-ParserElement::ParserElement(const std::string& file, const std::string& schemaFile, const std::string& xmlNamespace) :
+ParserElement::ParserElement(const std::string& file, const std::string& schemaFile, const std::string& xmlNamespace, bool pruneUnusedElements) :
 	domDocument(NULL),
 	domElement(NULL),
 	domParser(NULL),
 	filePath(file),
 	schemaFilePath(schemaFile),
-	xmlNamespace(xmlNamespace)
+	xmlNamespace(xmlNamespace),
+	pooledParser(NULL),
+	allocatedBytesBefore(0),
+	xPathExpressionCache()
 {
-	/** Initialize the Xerces usage */
-	xercesc::XMLPlatformUtils::Initialize();
-
-	domParser = new xercesc::XercesDOMParser();
+	/** Configured parsers are reused across files */
+	pooledParser = ParserPool::GetInstance().Acquire(pruneUnusedElements);
+	domParser = pooledParser->parser;
+	allocatedBytesBefore = pooledParser->memory.GetAllocatedBytes();
 }
 
 ParserElement::~ParserElement()
 {
-	/** Release the DOM elements */
-	delete domParser;
+	/** Release the compiled expressions before their document */
+	for (auto& expression : xPathExpressionCache)
+	{
+		expression.second->release();
+	}
+	xPathExpressionCache.clear();
 
-	/** Release the Xerces usage */
-	xercesc::XMLPlatformUtils::Terminate();
+	boost::format formatter(kMsgDocumentMemoryUsage[CliLogger::GetInstance().languageIndex]);
+	formatter % filePath % (pooledParser->memory.GetAllocatedBytes() - allocatedBytesBefore) % pooledParser->memory.GetReservedBytes();
+	LOG_DEBUG() << formatter.str();
+
+	/** Release the DOM elements and return the parser to the pool */
+	ParserPool::GetInstance().Release(pooledParser);
 }
 
 CliResult ParserElement::CreateElement()
+{
+	return BuildElement(true);
+}
+
+CliResult ParserElement::CreateUnvalidatedElement()
+{
+	return BuildElement(false);
+}
+
+CliResult ParserElement::BuildElement(bool validateSchema)
 {
 	try
 	{
@@ -73,7 +96,7 @@ CliResult ParserElement::CreateElement()
 		}
 
 		/** Create parse element by validating against the schema file */
-		CliResult res = parseFile();
+		CliResult res = parseFile(validateSchema);
 		if (!res.IsSuccessful())
 		{
 			return res;
@@ -103,33 +126,55 @@ CliResult ParserElement::CreateElement()
 	return CliResult();
 }
 
-CliResult ParserElement::parseFile()
+const xercesc::DOMXPathExpression* ParserElement::GetXPathExpression(const std::string& xPathExpression) const
+{
+	std::map<std::string, xercesc::DOMXPathExpression*>::const_iterator it = xPathExpressionCache.find(xPathExpression);
+	if (it != xPathExpressionCache.end())
+	{
+		return it->second;
+	}
+
+	/** The expressions do not use namespace prefixes, no resolver is needed */
+	XMLCh* expression = xercesc::XMLString::transcode(xPathExpression.data());
+	xercesc::DOMXPathExpression* compiledExpression = domDocument->createExpression(expression, NULL);
+	xercesc::XMLString::release(&expression);
+
+	xPathExpressionCache.insert(std::make_pair(xPathExpression, compiledExpression));
+
+	return compiledExpression;
+}
+
+CliResult ParserElement::parseFile(bool validateSchema)
 {
 	try
 	{
-		xercesc::XMLPlatformUtils::Initialize();
-		/** Validate for the schema file existance */
-		CliResult res = ParameterValidator::GetInstance().IsFileExists(schemaFilePath);
+		/** Load schema file constraints, compiled only once per run */
+		CliResult res = GrammarPool::GetInstance().LoadGrammar(schemaFilePath);
 		if (!res.IsSuccessful())
 		{
 			return res;
 		}
 
-		/** Load schema file constraints */
-		if (domParser->loadGrammar(schemaFilePath.data(),
-		                           xercesc::Grammar::SchemaGrammarType) == NULL)
+		/** Files validated by a previous run are trusted at this level */
+		ValidationLevel validationLevel = OpenConfiguratorCli::GetInstance().validationLevel;
+		std::string validationKey;
+		bool isTrusted = !validateSchema;
+
+		if (validateSchema && (validationLevel == ValidationLevel::TRUSTED))
 		{
-			return CliResult(CliErrorCode::ERROR_LOADING_GRAMMER,
-			                 kMsgErrorLoadingGrammer[CliLogger::GetInstance().languageIndex]);
+			res = ValidationCache::GetInstance().GetValidationKey(filePath, schemaFilePath, validationKey);
+			if (!res.IsSuccessful())
+			{
+				return res;
+			}
+
+			isTrusted = ValidationCache::GetInstance().IsValidated(validationKey);
 		}
 
-		/** Set validation checks required for the file */
-		domParser->setValidationScheme(xercesc::XercesDOMParser::Val_Always);
-		domParser->setDoNamespaces(true);
-		domParser->setDoXInclude(true);
-		domParser->setDoSchema(true);
-		domParser->setValidationConstraintFatal(true);
-		domParser->setValidationSchemaFullChecking(true);
+		/** The grammar is still applied to unvalidated files for the attribute defaults */
+		domParser->setValidationScheme(isTrusted ? xercesc::XercesDOMParser::Val_Never : xercesc::XercesDOMParser::Val_Always);
+		domParser->setIdentityConstraintChecking(!isTrusted);
+		domParser->setValidationSchemaFullChecking(validationLevel == ValidationLevel::FULL);
 
 		ParserErrorHandler parserErrorHandler;
 		domParser->setErrorHandler(&parserErrorHandler);
@@ -149,6 +194,16 @@ CliResult ParserElement::parseFile()
 
 			return CliResult(CliErrorCode::FILE_SCHEMA_NOT_VALID, formatter.str());
 		}
+
+		/** Later runs do not validate the file again */
+		if (validateSchema && (validationLevel == ValidationLevel::TRUSTED) && !isTrusted)
+		{
+			res = ValidationCache::GetInstance().AddValidated(validationKey);
+			if (!res.IsSuccessful())
+			{
+				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+			}
+		}
 	}
 	catch (const std::exception& e)
 	{
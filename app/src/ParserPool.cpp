@@ -0,0 +1,162 @@
+/**
+ * \file ParserPool.cpp
+ *
+ * \brief Implementation of ParserPool module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "ParserPool.h"
+#include "GrammarPool.h"
+#include "ArenaDOMParser.h"
+#include "PruningDOMParser.h"
+
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+PooledParser::PooledParser(bool pruneUnusedElements) :
+	memory(),
+	parser(NULL),
+	pruneUnusedElements(pruneUnusedElements)
+{
+	/** Parsers share the compiled schema grammars of the process-wide pool,
+	    only their documents are allocated from the arena */
+	if (pruneUnusedElements)
+	{
+		parser = new PruningDOMParser(&memory, GrammarPool::GetInstance().GetPool());
+	}
+	else
+	{
+		parser = new ArenaDOMParser(&memory, GrammarPool::GetInstance().GetPool());
+	}
+
+	/** Set validation checks required for all files */
+	parser->useCachedGrammarInParse(true);
+	parser->setValidationScheme(xercesc::XercesDOMParser::Val_Always);
+	parser->setDoNamespaces(true);
+	parser->setDoXInclude(true);
+	parser->setDoSchema(true);
+	parser->setValidationConstraintFatal(true);
+	parser->setValidationSchemaFullChecking(true);
+
+	/** Comments and formatting whitespace are never read by the import */
+	if (pruneUnusedElements)
+	{
+		parser->setCreateCommentNodes(false);
+		parser->setIncludeIgnorableWhitespace(false);
+	}
+}
+
+PooledParser::~PooledParser()
+{
+	/** Release the parser and its documents before the arena */
+	delete parser;
+}
+
+ParserPool::ParserPool() :
+	idleParsers(),
+	poolMutex()
+{
+	/** The grammar pool has to outlive the parsers which use it */
+	GrammarPool::GetInstance();
+
+	/** Keep Xerces initialized as long as pooled parsers are alive */
+	xercesc::XMLPlatformUtils::Initialize();
+}
+
+ParserPool::~ParserPool()
+{
+	Clear();
+
+	/** Release the Xerces usage */
+	xercesc::XMLPlatformUtils::Terminate();
+}
+
+ParserPool& ParserPool::GetInstance()
+{
+	static ParserPool instance;
+
+	return instance;
+}
+
+PooledParser* ParserPool::Acquire(bool pruneUnusedElements)
+{
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+
+		for (std::vector<PooledParser*>::iterator it = idleParsers.begin(); it != idleParsers.end(); ++it)
+		{
+			if ((*it)->pruneUnusedElements == pruneUnusedElements)
+			{
+				PooledParser* pooledParser = *it;
+				idleParsers.erase(it);
+				return pooledParser;
+			}
+		}
+	}
+
+	return new PooledParser(pruneUnusedElements);
+}
+
+void ParserPool::Release(PooledParser* pooledParser)
+{
+	if (pooledParser == NULL)
+	{
+		return;
+	}
+
+	try
+	{
+		/** Release the documents and make the parser ready for the next file.
+		    Nothing but the documents lives in the arena, it is rewound at once. */
+		pooledParser->parser->resetDocumentPool();
+		pooledParser->parser->reset();
+		pooledParser->parser->setErrorHandler(NULL);
+
+		pooledParser->memory.Reset();
+	}
+	catch (...)
+	{
+		delete pooledParser;
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(poolMutex);
+	idleParsers.push_back(pooledParser);
+}
+
+void ParserPool::Clear()
+{
+	std::lock_guard<std::mutex> lock(poolMutex);
+
+	for (PooledParser* pooledParser : idleParsers)
+	{
+		delete pooledParser;
+	}
+	idleParsers.clear();
+}
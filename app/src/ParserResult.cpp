@@ -77,15 +77,18 @@ CliResult ParserResult::CreateResult(const ParserElement& pElement,
 
 	try
 	{
-		/** Get result of Managing Node */
-		XMLCh* expression = xercesc::XMLString::transcode(transcodeString.data());
-		xercesc::DOMXPathResult* nResult = pElement.domDocument->evaluate(
-		                                       expression,
+		if (pElement.domDocument == NULL)
+		{
+			return CliResult(CliErrorCode::NULL_POINTER_FOUND,
+			                 kMsgNullPtrFound[CliLogger::GetInstance().languageIndex]);
+		}
+
+		/** Get result of Managing Node, the expression is compiled once per document */
+		const xercesc::DOMXPathExpression* expression = pElement.GetXPathExpression(transcodeString);
+		xercesc::DOMXPathResult* nResult = expression->evaluate(
 		                                       parentNode,
-		                                       NULL,
 		                                       xercesc::DOMXPathResult::ORDERED_NODE_SNAPSHOT_TYPE,
 		                                       NULL);
-		xercesc::XMLString::release(&expression);
 
 		resultNodeValue = nResult->getNodeValue();
 		if (resultNodeValue == NULL)
@@ -96,15 +99,21 @@ CliResult ParserResult::CreateResult(const ParserElement& pElement,
 			return CliResult(CliErrorCode::NO_RESULT_FOR_XPATH, formatter.str());
 		}
 
-		std::vector<std::string> attributeNames;
-		boost::split(attributeNames, formatString, boost::is_any_of(","));
+		std::vector<std::basic_string<XMLCh> > attributeNames = GetAttributeNames(formatString);
+
+		/** The row buffer is reused, its strings keep their capacity between nodes */
+		std::vector<std::string> nodeVec;
 
 		/**  Parse the parameters */
 		for (XMLSize_t nIndex = 0; nIndex < nResult->getSnapshotLength(); nIndex++)
 		{
 			nResult->snapshotItem(nIndex);
 			node.push_back(nResult->getNodeValue());
-			ParseAttributeValues(nResult->getNodeValue(), attributeNames);
+
+			if (GetAttributeValues(nResult->getNodeValue(), attributeNames, nodeVec))
+			{
+				this->parameters.AddRow(nodeVec);
+			}
 		}
 		nResult->release();
 	}
@@ -115,50 +124,59 @@ CliResult ParserResult::CreateResult(const ParserElement& pElement,
 	return CliResult();
 }
 
-void ParserResult::ParseAttributeValues(const xercesc::DOMNode* domNode,
-                                        const std::vector<std::string>& attributeName)
+std::vector<std::basic_string<XMLCh> > ParserResult::GetAttributeNames(const std::string& formatString)
+{
+	std::vector<std::string> names;
+	boost::split(names, formatString, boost::is_any_of(","));
+
+	/** Attribute names are ASCII, they are widened without a transcoder */
+	std::vector<std::basic_string<XMLCh> > attributeNames;
+	for (const std::string& name : names)
+	{
+		attributeNames.push_back(std::basic_string<XMLCh>(name.begin(), name.end()));
+	}
+
+	return attributeNames;
+}
+
+bool ParserResult::GetAttributeValues(const xercesc::DOMNode* domNode,
+                                      const std::vector<std::basic_string<XMLCh> >& attributeNames,
+                                      std::vector<std::string>& attributeValues)
 {
 	try
 	{
-		std::map<std::string, std::string> attributeValues;
-		std::vector<std::string> nodeVec;
-		if (domNode != NULL)
+		if ((domNode == NULL)
+		        || (domNode->getNodeType() != xercesc::DOMNode::ELEMENT_NODE)
+		        || !domNode->hasAttributes())
 		{
-			if (domNode->hasAttributes())
+			return false;
+		}
+
+		const xercesc::DOMElement* domElement = static_cast<const xercesc::DOMElement*>(domNode);
+
+		/** Existing strings of the output are overwritten to reuse their buffers */
+		attributeValues.resize(attributeNames.size());
+
+		/** Only the requested attributes are looked up and transcoded */
+		for (std::size_t column = 0; column < attributeNames.size(); column++)
+		{
+			const XMLCh* value = domElement->getAttribute(attributeNames[column].c_str());
+			if ((value == NULL) || (value[0] == 0))
 			{
-				xercesc::DOMNamedNodeMap* attributes = domNode->getAttributes();
-				const XMLSize_t attribCount = attributes->getLength();
-
-				for (XMLSize_t attribSize = 0; attribSize < attribCount; attribSize++)
-				{
-					xercesc::DOMNode* currentNode = attributes->item(attribSize);
-					if (currentNode->getNodeType() == xercesc::DOMNode::ATTRIBUTE_NODE)
-					{
-						char* attribute = xercesc::XMLString::transcode(currentNode->getNodeName());
-						char* val = xercesc::XMLString::transcode(currentNode->getNodeValue());
-
-						std::pair<std::string, std::string> item;
-						item = std::make_pair(std::string(attribute), std::string(val));
-						attributeValues.insert(item);
-
-						xercesc::XMLString::release(&attribute);
-						xercesc::XMLString::release(&val);
-					}
-				}
-
-				for (auto& attrName : attributeName)
-				{
-					if (attributeValues.find(attrName) != attributeValues.end())
-						nodeVec.push_back(attributeValues.at(attrName));
-					else
-						nodeVec.push_back("");
-				}
-				this->parameters.push_back(nodeVec);
+				attributeValues[column].clear();
+				continue;
 			}
+
+			char* val = xercesc::XMLString::transcode(value);
+			attributeValues[column].assign(val);
+			xercesc::XMLString::release(&val);
 		}
 	}
 	catch (const std::exception& e)
 	{
 		LOG_ERROR() << CliLogger::GetInstance().GetFailureErrorString(e).GetErrorMessage();
+		return false;
 	}
+
+	return true;
 }
@@ -0,0 +1,112 @@
+/**
+ * \file ParserResultTable.cpp
+ *
+ * \brief Implementation of ParserResultTable module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#include "ParserResultTable.h"
+#include <stdexcept>
+
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+ParserResultTable::Row::Row(const ParserResultTable& table,
+                            std::size_t firstCell,
+                            std::size_t cellCount) :
+	table(table),
+	firstCell(firstCell),
+	cellCount(cellCount)
+{
+}
+
+const std::string& ParserResultTable::Row::at(std::size_t column) const
+{
+	if (column >= cellCount)
+	{
+		throw std::out_of_range("ParserResultTable::Row::at");
+	}
+
+	return *(table.cells[firstCell + column]);
+}
+
+std::size_t ParserResultTable::Row::size() const
+{
+	return cellCount;
+}
+
+ParserResultTable::ParserResultTable() :
+	values(),
+	cells(),
+	rowOffsets()
+{
+}
+
+ParserResultTable::~ParserResultTable()
+{
+}
+
+void ParserResultTable::AddRow(const std::vector<std::string>& rowValues)
+{
+	rowOffsets.push_back(cells.size());
+	for (const std::string& value : rowValues)
+	{
+		cells.push_back(InternValue(value));
+	}
+}
+
+ParserResultTable::Row ParserResultTable::operator[](std::size_t row) const
+{
+	std::size_t lastCell = (row + 1 < rowOffsets.size()) ? rowOffsets[row + 1] : cells.size();
+
+	return Row(*this, rowOffsets[row], lastCell - rowOffsets[row]);
+}
+
+std::size_t ParserResultTable::size() const
+{
+	return rowOffsets.size();
+}
+
+bool ParserResultTable::empty() const
+{
+	return rowOffsets.empty();
+}
+
+const std::string* ParserResultTable::InternValue(const std::string& value)
+{
+	/** Values such as "rw", "UNSIGNED8" or "0x0000" repeat in most rows */
+	std::unordered_set<std::string>::const_iterator it = values.find(value);
+	if (it == values.end())
+	{
+		it = values.insert(value).first;
+	}
+
+	return &(*it);
+}
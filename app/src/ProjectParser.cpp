@@ -36,10 +36,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ProjectParser.h"
 #include "ParserResult.h"
 #include "ParameterValidator.h"
+#include "DeviceTemplateParser.h"
+#include "GrammarPool.h"
+#include "ParserPool.h"
 #include "IEC_Datatype.h"
 #include "ParameterAccess.h"
 #include "AccessType.h"
 #include "PDOMapping.h"
+#include "EnumConverter.h"
 
 using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
 using namespace IndustrialNetwork::POWERLINK::Core::API;
@@ -53,60 +57,21 @@ using namespace IndustrialNetwork::POWERLINK::Application;
 using namespace IndustrialNetwork::POWERLINK::Application::CliConstants;
 
 ProjectParser::ProjectParser() :
-	iecdataTypeMap(std::map<std::string, IEC_Datatype>()),
-	parameterAccessMap(std::map<std::string, ParameterAccess>()),
-	accessTypeMap(std::map<std::string, AccessType>()),
-	pdoMappingMap(std::map<std::string, PDOMapping>())
+	xdcContentKeys(),
+	deviceTemplateCache(),
+	deviceTemplateFailures(),
+	claimedContentKeys(),
+	templateMutex(),
+	templateCompleted(),
+	prefetchPaths(),
+	nextPrefetchPath(0),
+	prefetchStopped(false),
+	prefetchWorkers(),
+	validateInBackground(false),
+	schemaValidator(),
+	validationThreads(0),
+	nodeAssignmentCache()
 {
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("", IEC_Datatype::UNDEFINED));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("UNDEFINED", IEC_Datatype::UNDEFINED));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("BITSTRING", IEC_Datatype::BITSTRING));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("BOOL", IEC_Datatype::BOOL));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("BYTE", IEC_Datatype::BYTE));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("CHAR", IEC_Datatype::_CHAR));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("WORD", IEC_Datatype::WORD));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("DWORD", IEC_Datatype::DWORD));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("LWORD", IEC_Datatype::LWORD));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("SINT", IEC_Datatype::SINT));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("INT", IEC_Datatype::INT));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("DINT", IEC_Datatype::DINT));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("LINT", IEC_Datatype::LINT));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("USINT", IEC_Datatype::USINT));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("UINT", IEC_Datatype::UINT));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("UDINT", IEC_Datatype::UDINT));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("ULINT", IEC_Datatype::ULINT));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("REAL", IEC_Datatype::REAL));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("LREAL", IEC_Datatype::LREAL));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("STRING", IEC_Datatype::STRING));
-	iecdataTypeMap.insert(std::pair<std::string, IEC_Datatype>("WSTRING", IEC_Datatype::WSTRING));
-
-	parameterAccessMap.insert(std::pair<std::string, ParameterAccess>("constant", ParameterAccess::constant));
-	parameterAccessMap.insert(std::pair<std::string, ParameterAccess>("read", ParameterAccess::read));
-	parameterAccessMap.insert(std::pair<std::string, ParameterAccess>("write", ParameterAccess::write));
-	parameterAccessMap.insert(std::pair<std::string, ParameterAccess>("readWrite", ParameterAccess::readWrite));
-	parameterAccessMap.insert(std::pair<std::string, ParameterAccess>("readWriteInput", ParameterAccess::readWriteInput));
-	parameterAccessMap.insert(std::pair<std::string, ParameterAccess>("readWriteOutput", ParameterAccess::readWriteOutput));
-	parameterAccessMap.insert(std::pair<std::string, ParameterAccess>("noAccess", ParameterAccess::noAccess));
-	parameterAccessMap.insert(std::pair<std::string, ParameterAccess>("undefined", ParameterAccess::undefined));
-	parameterAccessMap.insert(std::pair<std::string, ParameterAccess>("", ParameterAccess::undefined));
-
-	accessTypeMap.insert(std::pair<std::string, AccessType>("", AccessType::UNDEFINED));
-	accessTypeMap.insert(std::pair<std::string, AccessType>("undefined", AccessType::UNDEFINED));
-	accessTypeMap.insert(std::pair<std::string, AccessType>("rw", AccessType::RW));
-	accessTypeMap.insert(std::pair<std::string, AccessType>("rws", AccessType::RWS));
-	accessTypeMap.insert(std::pair<std::string, AccessType>("wo", AccessType::WO));
-	accessTypeMap.insert(std::pair<std::string, AccessType>("wos", AccessType::WOS));
-	accessTypeMap.insert(std::pair<std::string, AccessType>("ro", AccessType::RO));
-	accessTypeMap.insert(std::pair<std::string, AccessType>("const", AccessType::CONST));
-	accessTypeMap.insert(std::pair<std::string, AccessType>("cond", AccessType::COND));
-
-	pdoMappingMap.insert(std::pair<std::string, PDOMapping>("", PDOMapping::UNDEFINED));
-	pdoMappingMap.insert(std::pair<std::string, PDOMapping>("undefined", PDOMapping::UNDEFINED));
-	pdoMappingMap.insert(std::pair<std::string, PDOMapping>("no", PDOMapping::NO));
-	pdoMappingMap.insert(std::pair<std::string, PDOMapping>("default", PDOMapping::DEFAULT));
-	pdoMappingMap.insert(std::pair<std::string, PDOMapping>("optional", PDOMapping::OPTIONAL));
-	pdoMappingMap.insert(std::pair<std::string, PDOMapping>("TPDO", PDOMapping::TPDO));
-	pdoMappingMap.insert(std::pair<std::string, PDOMapping>("RPDO", PDOMapping::RPDO));
 }
 
 ProjectParser::~ProjectParser()
@@ -131,44 +96,163 @@ CliResult ProjectParser::ParseXmlFile(const std::string& xmlPath)
 		return CliLogger::GetInstance().GetFailureErrorString(res);
 	}
 
+	/** Device templates of a previous run may be outdated */
+	xdcContentKeys.clear();
+	deviceTemplateCache.clear();
+	deviceTemplateFailures.clear();
+	claimedContentKeys.clear();
+	nodeAssignmentCache.clear();
+
 	/** Create results for MN, RMN abd CN nodes */
 	CliResult clires;
 	CliResult ceres;
-	ParserElement xmlParserElement(xmlPath, kXmlSchemaDefinitionFileName, kProjectNamespace);
+	ParserElement xmlParserElement(xmlPath, kXmlSchemaDefinitionFileName, kProjectNamespace, false);
+
+	/** With several jobs the files are validated in the background while they
+	    are imported, a single job validates each file in its only parse */
+	validateInBackground = (OpenConfiguratorCli::GetInstance().jobCount > 1);
 
-	ceres = xmlParserElement.CreateElement();
+	if (validateInBackground)
+	{
+		ceres = xmlParserElement.CreateUnvalidatedElement();
+	}
+	else
+	{
+		ceres = xmlParserElement.CreateElement();
+	}
 	if (!ceres.IsSuccessful())
 	{
 		return ceres;
 	}
 
-	clires = CreateProjectConfiguration(xmlParserElement);
+	std::vector<std::string> xdcPaths;
+	clires = CollectXdcPaths(xmlParserElement, xdcPaths);
 	if (!clires.IsSuccessful())
 	{
 		return clires;
 	}
 
-	clires = CreateMnNodeResults(xmlParserElement);
+	if (validateInBackground)
+	{
+		clires = StartValidation(xmlPath, xdcPaths);
+		if (!clires.IsSuccessful())
+		{
+			return clires;
+		}
+	}
+
+	clires = ImportProject(xmlParserElement, xdcPaths);
+
+	/** Workers still extracting templates an aborted import never asks for */
+	StopPrefetch();
+
+	/** An invalid project file replaces the result of the optimistic import */
+	CliResult valres;
+	if (validateInBackground)
+	{
+		valres = StopValidation(xmlPath);
+	}
+
+	/** Release the device templates of the run */
+	xdcContentKeys.clear();
+	deviceTemplateCache.clear();
+	deviceTemplateFailures.clear();
+	claimedContentKeys.clear();
+	nodeAssignmentCache.clear();
+
+	if (!valres.IsSuccessful())
+	{
+		return valres;
+	}
+
+	return clires;
+}
+
+CliResult ProjectParser::ImportProject(const ParserElement& element,
+                                       const std::vector<std::string>& xdcPaths)
+{
+	CliResult clires = CreateProjectConfiguration(element);
 	if (!clires.IsSuccessful())
 	{
 		return clires;
 	}
 
-	clires = CreateRmnNodeResults(xmlParserElement);
+	/** Read and extract the XDCs in parallel while the nodes below are imported in order */
+	clires = PrefetchDeviceTemplates(xdcPaths);
+	if (!clires.IsSuccessful())
+	{
+		LOG_WARN() << CliLogger::GetInstance().GetErrorString(clires);
+	}
+
+	clires = CreateMnNodeResults(element);
 	if (!clires.IsSuccessful())
 	{
 		return clires;
 	}
 
-	clires = CreateCnNodeResults(xmlParserElement);
+	clires = CreateRmnNodeResults(element);
 	if (!clires.IsSuccessful())
 	{
 		return clires;
 	}
 
+	return CreateCnNodeResults(element);
+}
+
+CliResult ProjectParser::StartValidation(const std::string& xmlPath,
+        const std::vector<std::string>& xdcPaths)
+{
+	try
+	{
+		/** Compile the grammars up front, the pool is read-only while the validation runs */
+		if (!xdcPaths.empty())
+		{
+			CliResult res = GrammarPool::GetInstance().LoadGrammar(kXdcSchemaDefinitionFileName);
+			if (!res.IsSuccessful())
+			{
+				return res;
+			}
+		}
+
+		/** Idle parsers do not use the synchronized string pool of the locked grammar pool */
+		ParserPool::GetInstance().Clear();
+		GrammarPool::GetInstance().LockPool();
+
+		/** The project file first, it is needed before any result is valid */
+		schemaValidator.AddFile(xmlPath, kXmlSchemaDefinitionFileName, kProjectNamespace);
+		for (const std::string& xdcPath : xdcPaths)
+		{
+			schemaValidator.AddFile(xdcPath, kXdcSchemaDefinitionFileName, kXDDNamespace);
+		}
+
+		/** The validation takes half of the thread budget, the prefetch the rest */
+		validationThreads = DeviceTemplateParser::GetInstance().ReserveThreads(std::max<std::size_t>(1, OpenConfiguratorCli::GetInstance().jobCount / 2));
+		schemaValidator.Start(static_cast<std::uint32_t>(validationThreads));
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
 	return CliResult();
 }
 
+CliResult ProjectParser::StopValidation(const std::string& xmlPath)
+{
+	/** The XDCs are waited for by the import of their nodes */
+	CliResult res = schemaValidator.Wait(xmlPath, kXmlSchemaDefinitionFileName, kProjectNamespace);
+
+	schemaValidator.Stop();
+	DeviceTemplateParser::GetInstance().ReleaseThreads(validationThreads);
+	validationThreads = 0;
+
+	/** Parsers of the workers must not outlive the locked grammar pool */
+	ParserPool::GetInstance().Clear();
+	GrammarPool::GetInstance().UnlockPool();
+
+	return res;
+}
+
 CliResult ProjectParser::CreateProjectConfiguration(const ParserElement& element)
 {
 	try
@@ -284,9 +368,9 @@ CliResult ProjectParser::CreateMnNodeResults(const ParserElement& element)
 		{
 			std::uint8_t nodeId = 0;
 
-			if (!mnResult.parameters[row].at(0).empty())
+			if (!NumberConverter::ToUInt8(mnResult.parameters[row].at(0), 10, nodeId))
 			{
-				nodeId = (std::uint8_t)std::stoi(mnResult.parameters[row].at(0));
+				return NumberConverter::GetConversionError(mnResult.parameters[row].at(0));
 			}
 
 			/** Core Library API call to create Node */
@@ -299,14 +383,12 @@ CliResult ProjectParser::CreateMnNodeResults(const ParserElement& element)
 				return CliLogger::GetInstance().GetFailureErrorString(res);
 			}
 
-			std::vector<std::string> forcedModularNodeObj;		/** Group of forced objects in Node */
-			std::vector<std::string> forcedModularNodeSubObj;	/** Group of forced sub objects in Node */
+			std::unordered_set<std::uint64_t> forcedObjects;	/** Forced sub-objects of node */
 
 			/** Update the forced objects of node */
 			CliResult clires = CreateForcedObjects(element,
 			                                       kForcedObjectNodeXpathExpression,
-			                                       forcedModularNodeObj,
-			                                       forcedModularNodeSubObj,
+			                                       forcedObjects,
 			                                       mnResult.node.at(row));
 			if (!clires.IsSuccessful())
 			{
@@ -316,8 +398,7 @@ CliResult ProjectParser::CreateMnNodeResults(const ParserElement& element)
 			/** Core Library API calls to import the XDD of node */
 			clires = UpdateNodeIdCollection(nodeId,
 			                                mnResult.parameters[row].at(1),	/** pathToXDC */
-			                                forcedModularNodeObj,
-			                                forcedModularNodeSubObj,
+			                                forcedObjects,
 			                                "", "", 0U);
 			if (!clires.IsSuccessful())
 			{
@@ -359,9 +440,9 @@ CliResult ProjectParser::CreateRmnNodeResults(const ParserElement& element)
 			{
 				std::uint8_t nodeId = 0;
 
-				if (!rmnResult.parameters[row].at(0).empty())
+				if (!NumberConverter::ToUInt8(rmnResult.parameters[row].at(0), 10, nodeId))
 				{
-					nodeId = (std::uint8_t)std::stoi(rmnResult.parameters[row].at(0));
+					return NumberConverter::GetConversionError(rmnResult.parameters[row].at(0));
 				}
 
 				/** Core Library API call to create Node */
@@ -376,14 +457,12 @@ CliResult ProjectParser::CreateRmnNodeResults(const ParserElement& element)
 				}
 
 				CliResult clires;
-				std::vector<std::string> forcedModularNodeObj;		/** Group of forced objects in Node */
-				std::vector<std::string> forcedModularNodeSubObj;	/** Group of forced sub objects in Node */
+				std::unordered_set<std::uint64_t> forcedObjects;	/** Forced sub-objects of node */
 
 				/** Update the forced objects of node */
 				clires = CreateForcedObjects(element,
 				                             kForcedObjectNodeXpathExpression,
-				                             forcedModularNodeObj,
-				                             forcedModularNodeSubObj,
+				                             forcedObjects,
 				                             rmnResult.node.at(row));
 				if (!clires.IsSuccessful())
 				{
@@ -393,8 +472,7 @@ CliResult ProjectParser::CreateRmnNodeResults(const ParserElement& element)
 				/** Core Library API calls to import the XDC of node */
 				clires = UpdateNodeIdCollection(nodeId,
 				                                rmnResult.parameters[row].at(1),	/** pathToXDC */
-				                                forcedModularNodeObj,
-				                                forcedModularNodeSubObj,
+				                                forcedObjects,
 				                                "", "", 0U);
 				if (!clires.IsSuccessful())
 				{
@@ -442,9 +520,9 @@ CliResult ProjectParser::CreateCnNodeResults(const ParserElement& element)
 			CliResult clires;
 			CliResult subclires;
 
-			if (!cnResult.parameters[row].at(0).empty())
+			if (!NumberConverter::ToUInt8(cnResult.parameters[row].at(0), 10, nodeId))
 			{
-				nodeId = (std::uint8_t)std::stoi(cnResult.parameters[row].at(0));
+				return NumberConverter::GetConversionError(cnResult.parameters[row].at(0));
 			}
 
 			clires = subCnResult.CreateResult(element,
@@ -483,12 +561,11 @@ CliResult ProjectParser::CreateCnNodeResults(const ParserElement& element)
 					return CliLogger::GetInstance().GetFailureErrorString(res);
 				}
 
-				std::vector<std::string> forcedModularNodeObj;		/** Group of forced objects in Node */
-				std::vector<std::string> forcedModularNodeSubObj;	/** Group of forced sub objects in Node */
+				std::unordered_set<std::uint64_t> forcedObjects;	/** Forced sub-objects of node */
 
 				/** Update the forced objects of modular head node */
 				subclires = CreateForcedObjects(element, kForcedObjectNodeXpathExpression,
-				                                forcedModularNodeObj, forcedModularNodeSubObj,
+				                                forcedObjects,
 				                                cnResult.node.at(row));
 				if (!subclires.IsSuccessful())
 				{
@@ -498,7 +575,7 @@ CliResult ProjectParser::CreateCnNodeResults(const ParserElement& element)
 				/** Core Library API calls to import the XDC of node */
 				subclires = UpdateNodeIdCollection(nodeId,
 				                                   cnResult.parameters[row].at(1),				/** pathToXDC */
-				                                   forcedModularNodeObj, forcedModularNodeSubObj,
+				                                   forcedObjects,
 				                                   "", "", 0U);
 				if (!subclires.IsSuccessful())
 				{
@@ -524,12 +601,11 @@ CliResult ProjectParser::CreateCnNodeResults(const ParserElement& element)
 					return CliLogger::GetInstance().GetFailureErrorString(res);
 				}
 
-				std::vector<std::string> forcedModularNodeObj;		/** Group of forced objects in Node */
-				std::vector<std::string> forcedModularNodeSubObj;	/** Group of forced sub objects in Node */
+				std::unordered_set<std::uint64_t> forcedObjects;	/** Forced sub-objects of node */
 
 				/** Update the forced objects of modular head node */
 				subclires = CreateForcedObjects(element, kForcedObjectNodeXpathExpression,
-				                                forcedModularNodeObj, forcedModularNodeSubObj,
+				                                forcedObjects,
 				                                cnResult.node.at(row));
 				if (!subclires.IsSuccessful())
 				{
@@ -538,7 +614,7 @@ CliResult ProjectParser::CreateCnNodeResults(const ParserElement& element)
 
 				/** Core Library API calls to import the XDC of modular head node */
 				subclires = UpdateNodeIdCollection(nodeId, cnResult.parameters[row].at(1),	/** pathToXDC */
-				                                   forcedModularNodeObj, forcedModularNodeSubObj,
+				                                   forcedObjects,
 				                                   "", "", 0U);
 				if (!subclires.IsSuccessful())
 				{
@@ -579,23 +655,21 @@ CliResult ProjectParser::CreateCnNodeResults(const ParserElement& element)
 						else
 						{
 							CliResult foRes;
+							std::unordered_set<std::uint64_t> forcedObjectsMod;	/** Forced sub-objects of node */
 
-							for (std::uint32_t moduleRow = 0; moduleRow < moduleResult.parameters.size(); moduleRow++)
+							/** The forced objects belong to the interface and apply to each of its modules */
+							foRes = CreateForcedObjects(element, kForcedObjectXpathExpression,
+							                            forcedObjectsMod,
+							                            subCnResult.node.at(subRow));
+							if (!foRes.IsSuccessful())
 							{
-								std::vector<std::string> forcedModularNodeObjMod;		/** Group of forced objects in Node */
-								std::vector<std::string> forcedModularNodeSubObjMod;	/** Group of forced sub objects in Node */
-
-								/** Update the forced objects of modular node */
-								foRes = CreateForcedObjects(element, kForcedObjectXpathExpression,
-								                            forcedModularNodeObjMod, forcedModularNodeSubObjMod,
-								                            subCnResult.node.at(subRow));
-								if (!foRes.IsSuccessful())
-								{
-									LOG_WARN() << CliLogger::GetInstance().GetErrorString(foRes);
-								}
+								LOG_WARN() << CliLogger::GetInstance().GetErrorString(foRes);
+							}
 
+							for (std::uint32_t moduleRow = 0; moduleRow < moduleResult.parameters.size(); moduleRow++)
+							{
 								foRes = CreateModule(nodeId,
-								                     forcedModularNodeObjMod, forcedModularNodeSubObjMod,
+								                     forcedObjectsMod,
 								                     subCnResult.parameters[subRow].at(0),				/** Interface Unique ID */
 								                     moduleResult.parameters[moduleRow].at(0),			/** Module name */
 								                     moduleResult.parameters[moduleRow].at(1),			/** Module position */
@@ -621,56 +695,7 @@ CliResult ProjectParser::CreateCnNodeResults(const ParserElement& element)
 	return CliResult();
 }
 
-IEC_Datatype ProjectParser::GetIecDataType(const xercesc::DOMNode* node)
-{
-	IEC_Datatype data = IEC_Datatype::UNDEFINED;
-
-	try
-	{
-		if (node->hasChildNodes())
-		{
-			xercesc::DOMNodeList* childNode = node->getChildNodes();
-			const XMLSize_t nodeCount = childNode->getLength();
-
-			for (XMLSize_t index = 0; index < nodeCount; index++)
-			{
-				xercesc::DOMNode* currentNode = childNode->item(index);
-
-				if ((currentNode->getNodeType()) && (currentNode->getNodeType() == xercesc::DOMNode::ELEMENT_NODE))
-				{
-					char* subNodeName = xercesc::XMLString::transcode(currentNode->getNodeName());
-					std::string childNodeName = subNodeName;
-
-					xercesc::XMLString::release(&subNodeName);
-
-					if ((childNodeName.compare("defaultValue") == 0) ||
-					        (childNodeName.compare("allowedValues") == 0) ||
-					        (childNodeName.compare("actualValue") == 0) ||
-					        (childNodeName.compare("substituteValue") == 0) ||
-					        (childNodeName.compare("unit") == 0) ||
-					        (childNodeName.compare("property") == 0))
-					{
-						return data;
-					}
-
-					data = GetDataType(childNodeName);
-				}
-			}
-		}
-	}
-	catch (const std::exception& e)
-	{
-		CliResult res = CliLogger::GetInstance().GetFailureErrorString(e);
-
-		LOG_ERROR() << res.GetErrorMessage();
-
-		return IEC_Datatype::UNDEFINED;
-	}
-
-	return data;
-}
-
-CliResult ProjectParser::CreateStructDataType(const ParserElement& element,
+CliResult ProjectParser::CreateStructDataType(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId,
         const std::string& interfaceId,
         const std::string& modId,
@@ -678,22 +703,13 @@ CliResult ProjectParser::CreateStructDataType(const ParserElement& element,
 {
 	try
 	{
-		ParserResult pResult;
-
-		CliResult crres = pResult.CreateResult(element, kStructXpathExpression,
-		                                       kFormatStrStructXpathExpression);
-		if (!crres.IsSuccessful())
-		{
-			return crres;
-		}
-
-		for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+		for (const XdcStructType& structType : deviceTemplate.structs)
 		{
 			/** Core Library API call to create StructDatatype */
 			Result res = OpenConfiguratorCore::GetInstance().CreateStructDatatype(
 			                 OpenConfiguratorCli::GetInstance().networkName,
-			                 nodeId, pResult.parameters[row].at(0),		/** uniqueID */
-			                 pResult.parameters[row].at(1),				/** name */
+			                 nodeId, structType.attributes.at(0),		/** uniqueID */
+			                 structType.attributes.at(1),				/** name */
 			                 interfaceId,
 			                 modId,
 			                 modPosition);
@@ -702,36 +718,31 @@ CliResult ProjectParser::CreateStructDataType(const ParserElement& element,
 				return CliLogger::GetInstance().GetFailureErrorString(res);
 			}
 
-			ParserResult varDecResult;
-
-			CliResult subcrres = varDecResult.CreateResult(element, kStructVarXpathExpression,
-			                     kFormatStrStructVarXpathExpression,
-			                     pResult.node.at(row));
+			CliResult subcrres = structType.varDeclarationResult;
 			if (!subcrres.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
 			}
 			else
 			{
-				for (std::uint32_t subrow = 0; subrow < varDecResult.parameters.size(); subrow++)
+				for (const XdcVarDeclarationType& varDeclaration : structType.varDeclarations)
 				{
-					IEC_Datatype data = GetIecDataType(varDecResult.node.at(subrow));
 					/** Set default value to size if value is empty */
 					std::uint32_t varDeclSize = 1U;
 
-					if (!varDecResult.parameters[subrow].at(2).empty())
+					if (!NumberConverter::ToUInt32(varDeclaration.attributes.at(2), 10, varDeclSize))
 					{
-						varDeclSize = (std::uint32_t)std::stoi(varDecResult.parameters[subrow].at(2));
+						return NumberConverter::GetConversionError(varDeclaration.attributes.at(2));
 					}
 
 					/** Core Library API call to create VarDeclaration */
 					res = OpenConfiguratorCore::GetInstance().CreateVarDeclaration(
 					          OpenConfiguratorCli::GetInstance().networkName,
 					          nodeId,
-					          pResult.parameters[row].at(0),										/** parent uniqueID */
-					          varDecResult.parameters[subrow].at(0),								/** sub item uniqueID */
-					          varDecResult.parameters[subrow].at(1), 								/** sub item name */
-					          data,
+					          structType.attributes.at(0),										/** parent uniqueID */
+					          varDeclaration.attributes.at(0),									/** sub item uniqueID */
+					          varDeclaration.attributes.at(1), 									/** sub item name */
+					          varDeclaration.dataType,
 					          varDeclSize,														/** sub item size */
 					          "",
 					          interfaceId,
@@ -750,10 +761,10 @@ CliResult ProjectParser::CreateStructDataType(const ParserElement& element,
 		return CliLogger::GetInstance().GetFailureErrorString(e);
 	}
 
-	return CliResult();
+	return deviceTemplate.structResult;
 }
 
-CliResult ProjectParser::CreateArrayDataType(const ParserElement& element,
+CliResult ProjectParser::CreateArrayDataType(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId,
         const std::string& interfaceId,
         const std::string& modId,
@@ -761,54 +772,39 @@ CliResult ProjectParser::CreateArrayDataType(const ParserElement& element,
 {
 	try
 	{
-		ParserResult pResult;
-
-		CliResult crres = pResult.CreateResult(element, kArrayXpathExpression,
-		                                       kFormatStrArrayXpathExpression);
-		if (!crres.IsSuccessful())
-		{
-			return crres;
-		}
-
-		for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+		for (const XdcArrayType& arrayType : deviceTemplate.arrays)
 		{
-			ParserResult subpResult;
-
-			IEC_Datatype data = GetIecDataType(pResult.node.at(row));
-
-			CliResult subcrres = subpResult.CreateResult(element, kArraySubRangeXpathExpression,
-			                     kFormatStrArraySubRangeXpathExpression,
-			                     pResult.node.at(row));
+			CliResult subcrres = arrayType.subRangeResult;
 			if (!subcrres.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
 			}
 			else
 			{
-				for (std::uint32_t subrow = 0; subrow < subpResult.parameters.size(); subrow++)
+				for (const std::vector<std::string>& subRange : arrayType.subRanges)
 				{
 					std::uint32_t lowerLimit = 1U;
 					std::uint32_t upperLimit = 1U;
 
-					if (!subpResult.parameters[subrow].at(0).empty())
+					if (!NumberConverter::ToUInt32(subRange.at(0), 10, lowerLimit))
 					{
-						lowerLimit = (std::uint32_t)std::stoi(subpResult.parameters[subrow].at(0));
+						return NumberConverter::GetConversionError(subRange.at(0));
 					}
 
-					if (!subpResult.parameters[subrow].at(1).empty())
+					if (!NumberConverter::ToUInt32(subRange.at(1), 10, upperLimit))
 					{
-						upperLimit = (std::uint32_t)std::stoi(subpResult.parameters[subrow].at(1));
+						return NumberConverter::GetConversionError(subRange.at(1));
 					}
 
 					/** Core Library API call to create ArrayDatatype */
 					Result res = OpenConfiguratorCore::GetInstance().CreateArrayDatatype(
 					                 OpenConfiguratorCli::GetInstance().networkName,
 					                 nodeId,
-					                 pResult.parameters[row].at(0),  								/** uniqueID */
-					                 pResult.parameters[row].at(1),  								/** name */
+					                 arrayType.attributes.at(0),  								/** uniqueID */
+					                 arrayType.attributes.at(1),  								/** name */
 					                 lowerLimit,
 					                 upperLimit,
-					                 data,
+					                 arrayType.dataType,
 					                 interfaceId,
 					                 modId,
 					                 modPosition);
@@ -825,10 +821,10 @@ CliResult ProjectParser::CreateArrayDataType(const ParserElement& element,
 		return CliLogger::GetInstance().GetFailureErrorString(e);
 	}
 
-	return CliResult();
+	return deviceTemplate.arrayResult;
 }
 
-CliResult ProjectParser::CreateDataType(const ParserElement& element,
+CliResult ProjectParser::CreateDataType(const DeviceTemplate& deviceTemplate,
                                         const std::uint8_t nodeId,
                                         const std::string& interfaceId,
                                         const std::string& modId,
@@ -837,14 +833,14 @@ CliResult ProjectParser::CreateDataType(const ParserElement& element,
 	CliResult res;
 
 	/** Creates struct data type of node into the core library */
-	res = CreateStructDataType(element, nodeId, interfaceId, modId, modposition);
+	res = CreateStructDataType(deviceTemplate, nodeId, interfaceId, modId, modposition);
 	if (!res.IsSuccessful())
 	{
 		return res;
 	}
 
 	/** Creates array data type of node into the core library */
-	res = CreateArrayDataType(element, nodeId, interfaceId, modId, modposition);
+	res = CreateArrayDataType(deviceTemplate, nodeId, interfaceId, modId, modposition);
 	if (!res.IsSuccessful())
 	{
 		return res;
@@ -853,53 +849,90 @@ CliResult ProjectParser::CreateDataType(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::SetParamAllowedValue(const ParserElement& element,
-        const std::uint8_t nodeId,
-        const xercesc::DOMNode* node,
-        const std::string& uniqueId,
-        const std::string& interfaceId,
-        const std::string& modId,
-        const std::uint32_t modPosition)
+CliResult ProjectParser::CheckParameterRef(const DeviceTemplate& deviceTemplate,
+        const std::string& uniqueIdRef,
+        const bool isTemplate)
 {
-	ParserResult pResult;
-
-	CliResult crres = pResult.CreateResult(element,
-	                                       kParameterAllowedValueXpathExpression,
-	                                       kFormatStrParameterAllowedValueXpathExpression,
-	                                       node);
-	if (!crres.IsSuccessful())
+	if (deviceTemplate.FindParameter(uniqueIdRef, isTemplate) == NULL)
 	{
-		return crres;
+		boost::format formatter(kMsgUniqueIdRefNotFound[CliLogger::GetInstance().languageIndex]);
+		formatter % uniqueIdRef;
+
+		return CliResult(CliErrorCode::INVALID_PARAMETERS, formatter.str());
 	}
 
-	std::vector<std::string> allowedValuelist;
-	std::string uniqueIdOutput = uniqueId;
+	return CliResult();
+}
 
-	for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
-	{
-		allowedValuelist.push_back(pResult.parameters[row].at(0));
-	}
+CliResult ProjectParser::SetParamValues(const XdcParameterType& parameter,
+                                        const std::uint8_t nodeId,
+                                        const std::string& interfaceId,
+                                        const std::string& modId,
+                                        const std::uint32_t modPosition)
+{
+	std::string parameterId = parameter.attributes.at(0);
 
+	/** The parameter ID of a module is resolved once for all values */
 	if (!modId.empty())
 	{
-		CliResult clires;
-
-		clires = ProjectParser::GetInstance().GetNewParameterId(nodeId,
-		         interfaceId, modId,
-		         modPosition, uniqueId,
-		         uniqueIdOutput);
+		CliResult clires = GetNewParameterId(nodeId, interfaceId, modId,
+		                                     modPosition, parameter.attributes.at(0),
+		                                     parameterId);
 		if (!clires.IsSuccessful())
 		{
 			return clires;
 		}
 	}
 
+	CliResult subcrres;
+
+	/** Updates the allowed values of parameter.*/
+	subcrres = SetParamAllowedValue(parameter, nodeId, parameterId);
+	if (!subcrres.IsSuccessful())
+	{
+		LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
+	}
+
+	/** Updates the allowed range of parameter.*/
+	subcrres = SetParamAllowedRange(parameter, nodeId, parameterId);
+	if (!subcrres.IsSuccessful())
+	{
+		LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
+	}
+
+	/** Updates the default value of parameter.*/
+	subcrres = SetParamDefaultValue(parameter, nodeId, parameterId);
+	if (!subcrres.IsSuccessful())
+	{
+		LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
+	}
+
+	/** Updates the actual value of parameter.*/
+	subcrres = SetParamActualValue(parameter, nodeId, parameterId);
+	if (!subcrres.IsSuccessful())
+	{
+		LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
+	}
+
+	return CliResult();
+}
+
+CliResult ProjectParser::SetParamAllowedValue(const XdcParameterType& parameter,
+        const std::uint8_t nodeId,
+        const std::string& parameterId)
+{
+	CliResult crres = parameter.allowedValueResult;
+	if (!crres.IsSuccessful())
+	{
+		return crres;
+	}
+
 	/** Core Library API call to set allowed parameter values */
 	Result res = OpenConfiguratorCore::GetInstance().SetParameterAllowedValues(
 	                 OpenConfiguratorCli::GetInstance().networkName,
 	                 nodeId,
-	                 uniqueIdOutput,
-	                 allowedValuelist);
+	                 parameterId,
+	                 parameter.allowedValues);
 	if (!res.IsSuccessful())
 	{
 		return CliLogger::GetInstance().GetFailureErrorString(res);
@@ -908,68 +941,23 @@ CliResult ProjectParser::SetParamAllowedValue(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::SetParamAllowedRange(const ParserElement& element,
+CliResult ProjectParser::SetParamAllowedRange(const XdcParameterType& parameter,
         const std::uint8_t nodeId,
-        const xercesc::DOMNode* node,
-        const std::string& uniqueId,
-        const std::string& interfaceId,
-        const std::string& modId,
-        const std::uint32_t modPosition)
+        const std::string& parameterId)
 {
-	ParserResult pResult;
-
-	CliResult crres = pResult.CreateResult(element,
-	                                       kParameterAllowedValueRangeXpathExpression,
-	                                       kFormatStrParameterAllowedValueRangeXpathExpression,
-	                                       node);
+	CliResult crres = parameter.allowedRangeResult;
 	if (!crres.IsSuccessful())
 	{
 		return crres;
 	}
 
-	for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+	for (const XdcAllowedRangeType& allowedRange : parameter.allowedRanges)
 	{
-		ParserResult minpResult;
-		ParserResult maxpResult;
-		CliResult subcrres;
-		std::string minValue = "";
-		std::string maxValue = "";
-		std::string uniqueIdOutput = uniqueId;
-
-		subcrres = minpResult.CreateResult(element,
-		                                   kParameterMinValueXpathExpression,
-		                                   kFormatStrParameterMinValueXpathExpression,
-		                                   pResult.node.at(row));
-		if (subcrres.IsSuccessful())
-		{
-			minValue = minpResult.parameters[0].at(0);
-		}
-
-		subcrres = maxpResult.CreateResult(element,
-		                                   kParameterMaxValueXpathExpression,
-		                                   kFormatStrParameterMaxValueXpathExpression,
-		                                   pResult.node.at(row));
-		if (subcrres.IsSuccessful())
-		{
-			maxValue = maxpResult.parameters[0].at(0);
-		}
-
-		if (!modId.empty())
-		{
-			subcrres = ProjectParser::GetInstance().GetNewParameterId(nodeId,
-			           interfaceId, modId,
-			           modPosition, uniqueId,
-			           uniqueIdOutput);
-			if (!subcrres.IsSuccessful())
-			{
-				return subcrres;
-			}
-		}
-
 		/** Core Library API call to set allowed parameter values */
 		Result res = OpenConfiguratorCore::GetInstance().SetParameterAllowedRange(
 		                 OpenConfiguratorCli::GetInstance().networkName,
-		                 nodeId, uniqueIdOutput, minValue, maxValue);
+		                 nodeId, parameterId,
+		                 allowedRange.minValue, allowedRange.maxValue);
 		if (!res.IsSuccessful())
 		{
 			return CliLogger::GetInstance().GetFailureErrorString(res);
@@ -979,45 +967,20 @@ CliResult ProjectParser::SetParamAllowedRange(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::SetParamActualValue(const ParserElement& element,
+CliResult ProjectParser::SetParamActualValue(const XdcParameterType& parameter,
         const std::uint8_t nodeId,
-        const xercesc::DOMNode* node,
-        const std::string& uniqueId,
-        const std::string& interfaceId,
-        const std::string& modId,
-        const std::uint32_t modPosition)
+        const std::string& parameterId)
 {
-	ParserResult pResult;
-
-	CliResult crres = pResult.CreateResult(element,
-	                                       kParameterActualValueXpathExpression,
-	                                       kFormatStrParameterActualValueXpathExpression,
-	                                       node);
+	CliResult crres = parameter.actualValueResult;
 	if (!crres.IsSuccessful())
 	{
 		return crres;
 	}
 
-	std::string uniqueIdOutput = uniqueId;
-
-	if (!modId.empty())
-	{
-		CliResult clires;
-
-		clires = ProjectParser::GetInstance().GetNewParameterId(nodeId,
-		         interfaceId, modId,
-		         modPosition, uniqueId,
-		         uniqueIdOutput);
-		if (!clires.IsSuccessful())
-		{
-			return clires;
-		}
-	}
-
 	/** Core Library API call to set actual parameter values */
 	Result res = OpenConfiguratorCore::GetInstance().SetParameterActualValue(
 	                 OpenConfiguratorCli::GetInstance().networkName,
-	                 nodeId, uniqueIdOutput, pResult.parameters[0].at(0));
+	                 nodeId, parameterId, parameter.actualValue);
 	if (!res.IsSuccessful())
 	{
 		return CliLogger::GetInstance().GetFailureErrorString(res);
@@ -1026,43 +989,20 @@ CliResult ProjectParser::SetParamActualValue(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::SetParamDefaultValue(const ParserElement& element,
+CliResult ProjectParser::SetParamDefaultValue(const XdcParameterType& parameter,
         const std::uint8_t nodeId,
-        const xercesc::DOMNode* node,
-        const std::string& uniqueId,
-        const std::string& interfaceId,
-        const std::string& modId,
-        const std::uint32_t modPosition)
+        const std::string& parameterId)
 {
-	ParserResult pResult;
-
-	CliResult crres = pResult.CreateResult(element,
-	                                       kParameterDefaultValueXpathExpression,
-	                                       kFormatStrParameterDefaultValueXpathExpression,
-	                                       node);
+	CliResult crres = parameter.defaultValueResult;
 	if (!crres.IsSuccessful())
 	{
 		return crres;
 	}
 
-	std::string uniqueIdOutput = uniqueId;
-
-	if (!modId.empty())
-	{
-		CliResult clires = ProjectParser::GetInstance().GetNewParameterId(nodeId,
-		                   interfaceId, modId,
-		                   modPosition, uniqueId,
-		                   uniqueIdOutput);
-		if (!clires.IsSuccessful())
-		{
-			return clires;
-		}
-	}
-
 	/** Core Library API call to set actual parameter values */
 	Result res = OpenConfiguratorCore::GetInstance().SetParameterDefaultValue(
 	                 OpenConfiguratorCli::GetInstance().networkName,
-	                 nodeId, uniqueIdOutput, pResult.parameters[0].at(0));
+	                 nodeId, parameterId, parameter.defaultValue);
 	if (!res.IsSuccessful())
 	{
 		return CliLogger::GetInstance().GetFailureErrorString(res);
@@ -1071,40 +1011,35 @@ CliResult ProjectParser::SetParamDefaultValue(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::CreateParameterTemplate(const ParserElement& element,
+CliResult ProjectParser::CreateParameterTemplate(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId,
         const std::string& interfaceId,
         const std::string& modId,
         const std::uint32_t modPosition)
 {
-	ParserResult pResult;
-
-	CliResult crres = pResult.CreateResult(element, kParameterTemplateXpathExpression,
-	                                       kFormatStrParameterTemplateXpathExpression);
+	CliResult crres = deviceTemplate.parameterTemplateResult;
 	if (!crres.IsSuccessful())
 	{
 		LOG_WARN() << crres.GetErrorMessage();
 	}
 	else
 	{
-		for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+		for (const XdcParameterType& parameterTemplate : deviceTemplate.parameterTemplates)
 		{
-			ParameterAccess accessOfParameter = GetParameterAccess(pResult.parameters[row].at(1));
-			IEC_Datatype data = GetIecDataType(pResult.node.at(row));
-
-			ParserResult subpResult;
+			ParameterAccess accessOfParameter = ParameterAccess::undefined;
+			if (!EnumConverter::ToParameterAccess(parameterTemplate.attributes.at(1), accessOfParameter))
+			{
+				return NumberConverter::GetConversionError(parameterTemplate.attributes.at(1));
+			}
 
-			CliResult subcrres = subpResult.CreateResult(element,
-			                     kParameterDataTypeIdRefXpathExpression,
-			                     kFormatStrParameterDataTypeIdRefXpathExpression,
-			                     pResult.node.at(row));
+			CliResult subcrres = parameterTemplate.dataTypeIdRefResult;
 			if (!subcrres.IsSuccessful())
 			{
 				/** Core Library API call to create Parameter */
 				Result res = OpenConfiguratorCore::GetInstance().CreateParameter(
 				                 OpenConfiguratorCli::GetInstance().networkName,
-				                 nodeId, pResult.parameters[row].at(0),
-				                 accessOfParameter, data, true,
+				                 nodeId, parameterTemplate.attributes.at(0),
+				                 accessOfParameter, parameterTemplate.dataType, true,
 				                 interfaceId, modId, modPosition);
 				if (!res.IsSuccessful())
 				{
@@ -1113,15 +1048,19 @@ CliResult ProjectParser::CreateParameterTemplate(const ParserElement& element,
 			}
 			else
 			{
-				for (std::uint32_t subrow = 0; subrow < subpResult.parameters.size(); subrow++)
+				for (const std::vector<std::string>& dataTypeIdRef : parameterTemplate.dataTypeIdRefs)
 				{
-					ParameterAccess paramAccessSubNode = GetParameterAccess(subpResult.parameters[subrow].at(1));
+					ParameterAccess paramAccessSubNode = ParameterAccess::undefined;
+					if (!EnumConverter::ToParameterAccess(dataTypeIdRef.at(1), paramAccessSubNode))
+					{
+						return NumberConverter::GetConversionError(dataTypeIdRef.at(1));
+					}
 
 					/** Core Library API call to create Parameter */
 					Result res = OpenConfiguratorCore::GetInstance().CreateParameter(
 					                 OpenConfiguratorCli::GetInstance().networkName,
-					                 nodeId, pResult.parameters[row].at(0),
-					                 subpResult.parameters[subrow].at(0),
+					                 nodeId, parameterTemplate.attributes.at(0),
+					                 dataTypeIdRef.at(0),
 					                 paramAccessSubNode, true,
 					                 interfaceId, modId, modPosition);
 					if (!res.IsSuccessful())
@@ -1131,37 +1070,9 @@ CliResult ProjectParser::CreateParameterTemplate(const ParserElement& element,
 				}
 			}
 
-			/** Updates the allowed values of parameter template.*/
-			subcrres = SetParamAllowedValue(element, nodeId, pResult.node.at(row),
-			                                pResult.parameters[row].at(0), interfaceId,
-			                                modId, modPosition);
-			if (!subcrres.IsSuccessful())
-			{
-				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
-			}
-
-			/** Updates the allowed range of parameter template.*/
-			subcrres = SetParamAllowedRange(element, nodeId, pResult.node.at(row),
-			                                pResult.parameters[row].at(0), interfaceId,
-			                                modId, modPosition);
-			if (!subcrres.IsSuccessful())
-			{
-				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
-			}
-
-			/** Updates the default value of parameter template.*/
-			subcrres = SetParamDefaultValue(element, nodeId, pResult.node.at(row),
-			                                pResult.parameters[row].at(0), interfaceId,
-			                                modId, modPosition);
-			if (!subcrres.IsSuccessful())
-			{
-				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
-			}
-
-			/** Updates the actual value of parameter template.*/
-			subcrres = SetParamActualValue(element,  nodeId, pResult.node.at(row),
-			                               pResult.parameters[row].at(0), interfaceId,
-			                               modId, modPosition);
+			/** Updates the allowed, default and actual values of parameter template.*/
+			subcrres = SetParamValues(parameterTemplate, nodeId, interfaceId,
+			                          modId, modPosition);
 			if (!subcrres.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
@@ -1172,219 +1083,109 @@ CliResult ProjectParser::CreateParameterTemplate(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::CreateChildParameterGroup(const ParserElement& element,
+CliResult ProjectParser::CreateParameterGroup(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId,
-        const xercesc::DOMNode* parameterGroupNode,
-        const std::string& paramGroupUId,
         const std::string& interfaceId,
         const std::string& modId,
         const std::uint32_t modPosition)
 {
 	try
 	{
-		ParserResult pResult;
-
-		CliResult crres = pResult.CreateResult(element,
-		                                       kChildParameterGroupXpathExpression,
-		                                       kFormatStrChildParameterGroupXpathExpression,
-		                                       parameterGroupNode);
+		CliResult crres = deviceTemplate.parameterGroupResult;
 		if (!crres.IsSuccessful())
 		{
 			LOG_WARN() << crres.GetErrorMessage();
+			return CliResult();
 		}
-		else
+
+		/** Groups are created first, each parent before its children */
+		for (const XdcParameterGroupType& parameterGroup : deviceTemplate.parameterGroups)
 		{
-			for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+			Result res;
+
+			if (parameterGroup.parentUniqueId.empty())
 			{
-				if (pResult.parameters[row].at(1).empty())	/** Is conditionalUniqueIDRef empty */
-				{
-					std::uint8_t bitoffset = 0;
+				res = OpenConfiguratorCore::GetInstance().CreateParameterGroup(
+				          OpenConfiguratorCli::GetInstance().networkName,
+				          nodeId,
+				          parameterGroup.attributes.at(0), 							/** uniqueID */
+				          interfaceId, modId, modPosition);
+			}
+			else
+			{
+				std::uint8_t bitoffset = 0;
 
-					if (!pResult.parameters[row].at(3).empty())
-					{
-						bitoffset = (std::uint8_t)std::stoi(pResult.parameters[row].at(3));
-					}
+				if (!NumberConverter::ToUInt8(parameterGroup.attributes.at(3), 10, bitoffset))
+				{
+					return NumberConverter::GetConversionError(parameterGroup.attributes.at(3));
+				}
 
-					Result res = OpenConfiguratorCore::GetInstance().CreateParameterGroup(
-					                 OpenConfiguratorCli::GetInstance().networkName,
-					                 nodeId,
-					                 pResult.parameters[row].at(0), 									/** uniqueID */
-					                 paramGroupUId,
-					                 bitoffset,														/** bitOffset */
-					                 interfaceId, modId, modPosition);
-					if (!res.IsSuccessful())
-					{
-						return CliLogger::GetInstance().GetFailureErrorString(res);
-					}
+				if (parameterGroup.attributes.at(1).empty())	/** Is conditionalUniqueIDRef empty */
+				{
+					res = OpenConfiguratorCore::GetInstance().CreateParameterGroup(
+					          OpenConfiguratorCli::GetInstance().networkName,
+					          nodeId,
+					          parameterGroup.attributes.at(0), 						/** uniqueID */
+					          parameterGroup.parentUniqueId,
+					          bitoffset,											/** bitOffset */
+					          interfaceId, modId, modPosition);
 				}
 				else
 				{
-					std::uint8_t bitoffset = 0;
-
-					if (!pResult.parameters[row].at(3).empty())
-					{
-						bitoffset = (std::uint8_t)std::stoi(pResult.parameters[row].at(3));
-					}
-
-					Result res = OpenConfiguratorCore::GetInstance().CreateParameterGroup(
-					                 OpenConfiguratorCli::GetInstance().networkName,
-					                 nodeId,
-					                 pResult.parameters[row].at(0), 									/** uniqueID */
-					                 paramGroupUId,
-					                 pResult.parameters[row].at(1), 									/** conditionalUniqueIDRef */
-					                 pResult.parameters[row].at(2), 									/** conditionalValue */
-					                 bitoffset,														/** bitOffset */
-					                 interfaceId, modId, modPosition);
-					if (!res.IsSuccessful())
-					{
-						return CliLogger::GetInstance().GetFailureErrorString(res);
-					}
-				}
-
-				ParserResult subpResult;
-
-				CliResult subcrres = subpResult.CreateResult(element,
-				                     kChildParameterRefXpathExpression,
-				                     kFormatStrChildParameterRefXpathExpression,
-				                     pResult.node.at(row));
-				if (!subcrres.IsSuccessful())
-				{
-					LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
+					res = OpenConfiguratorCore::GetInstance().CreateParameterGroup(
+					          OpenConfiguratorCli::GetInstance().networkName,
+					          nodeId,
+					          parameterGroup.attributes.at(0), 						/** uniqueID */
+					          parameterGroup.parentUniqueId,
+					          parameterGroup.attributes.at(1), 						/** conditionalUniqueIDRef */
+					          parameterGroup.attributes.at(2), 						/** conditionalValue */
+					          bitoffset,											/** bitOffset */
+					          interfaceId, modId, modPosition);
 				}
-				else
-				{
-					for (std::uint32_t subrow = 0; subrow < subpResult.parameters.size(); subrow++)
-					{
-						if (subpResult.parameters[subrow].at(2).empty())	/** Is actualValue empty */
-						{
-							std::uint8_t bitoffset = 0;
-
-							if (!subpResult.parameters[subrow].at(3).empty())
-							{
-								bitoffset = (std::uint8_t)std::stoi(subpResult.parameters[subrow].at(3));
-							}
-
-							Result res = OpenConfiguratorCore::GetInstance().CreateParameterReference(
-							                 OpenConfiguratorCli::GetInstance().networkName,
-							                 nodeId, paramGroupUId,
-							                 subpResult.parameters[subrow].at(0),									/** uniqueIDRef */
-							                 "",
-							                 bitoffset, 																/** bitOffset */
-							                 interfaceId, modId, modPosition);
-							if (!res.IsSuccessful())
-							{
-								return CliLogger::GetInstance().GetFailureErrorString(res);
-							}
-						}
-						else
-						{
-							std::uint8_t bitoffset = 0;
-
-							if (!subpResult.parameters[subrow].at(3).empty())
-							{
-								bitoffset = (std::uint8_t)std::stoi(subpResult.parameters[subrow].at(3));
-							}
+			}
 
-							Result res = OpenConfiguratorCore::GetInstance().CreateParameterReference(
-							                 OpenConfiguratorCli::GetInstance().networkName,
-							                 nodeId,
-							                 pResult.parameters[row].at(0),											/** uniqueID */
-							                 subpResult.parameters[subrow].at(0),									/** uniqueIDRef */
-							                 subpResult.parameters[subrow].at(2),  									/** actualValue */
-							                 bitoffset,																/** bitOffset */
-							                 interfaceId, modId, modPosition);
-							if (!res.IsSuccessful())
-							{
-								return CliLogger::GetInstance().GetFailureErrorString(res);
-							}
-						}
-					}
-				}
+			if (!res.IsSuccessful())
+			{
+				return CliLogger::GetInstance().GetFailureErrorString(res);
 			}
 		}
-	}
-	catch (const std::exception& e)
-	{
-		return CliLogger::GetInstance().GetFailureErrorString(e);
-	}
-
-	return CliResult();
-}
 
-CliResult ProjectParser::CreateParameterGroup(const ParserElement& element,
-        const std::uint8_t nodeId,
-        const std::string& interfaceId,
-        const std::string& modId,
-        const std::uint32_t modPosition)
-{
-	try
-	{
-		ParserResult pResult;
-		CliResult crres = pResult.CreateResult(element,
-		                                       kParameterGroupXpathExpression,
-		                                       kFormatStrParameterGroupXpathExpression);
-		if (!crres.IsSuccessful())
-		{
-			LOG_WARN() << crres.GetErrorMessage();
-		}
-		else
+		/** References are created once all groups exist */
+		for (const XdcParameterGroupType& parameterGroup : deviceTemplate.parameterGroups)
 		{
-			for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+			CliResult subcrres = parameterGroup.parameterRefResult;
+			if (!subcrres.IsSuccessful())
 			{
-				Result res = OpenConfiguratorCore::GetInstance().CreateParameterGroup(
-				                 OpenConfiguratorCli::GetInstance().networkName,
-				                 nodeId,
-				                 pResult.parameters[row].at(0), 				/** uniqueID */
-				                 interfaceId, modId, modPosition);
-				if (!res.IsSuccessful())
-				{
-					return CliLogger::GetInstance().GetFailureErrorString(res);
-				}
-
-				CliResult subcrres;
+				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
+				continue;
+			}
 
-				subcrres = CreateChildParameterGroup(element, nodeId, pResult.node.at(row),
-				                                     pResult.parameters[row].at(0), interfaceId,
-				                                     modId, modPosition);
-				if (!subcrres.IsSuccessful())
+			for (const std::vector<std::string>& parameterRef : parameterGroup.parameterRefs)
+			{
+				CliResult refres = CheckParameterRef(deviceTemplate, parameterRef.at(0), false);	/** uniqueIDRef */
+				if (!refres.IsSuccessful())
 				{
-					LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
+					return refres;
 				}
 
-				ParserResult subpResult;
+				std::uint8_t bitoffset = 0;
 
-				subcrres = subpResult.CreateResult(element,
-				                                   kChildParameterRefXpathExpression,
-				                                   kFormatStrChildParameterRefXpathExpression,
-				                                   pResult.node.at(row));
-				if (!subcrres.IsSuccessful())
+				if (!NumberConverter::ToUInt8(parameterRef.at(3), 10, bitoffset))
 				{
-					LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
+					return NumberConverter::GetConversionError(parameterRef.at(3));
 				}
-				else
-				{
-					for (std::uint32_t subrow = 0; subrow < subpResult.parameters.size(); subrow++)
-					{
-						std::uint8_t bitoffset = 0;
-
-						if (!subpResult.parameters[subrow].at(3).empty())
-						{
-							bitoffset = (std::uint8_t)std::stoi(subpResult.parameters[subrow].at(3));
-						}
 
-						res = OpenConfiguratorCore::GetInstance().CreateParameterReference(
-						          OpenConfiguratorCli::GetInstance().networkName,
-						          nodeId,
-						          pResult.parameters[row].at(0),											/** uniqueID */
-						          subpResult.parameters[subrow].at(0),									/** uniqueIDRef */
-						          subpResult.parameters[subrow].at(2),  									/** actualValue */
-						          bitoffset, 																/** bitOffset */
-						          interfaceId, modId, modPosition);
-						if (!res.IsSuccessful())
-						{
-							return CliLogger::GetInstance().GetFailureErrorString(res);
-						}
-					}
+				Result res = OpenConfiguratorCore::GetInstance().CreateParameterReference(
+				                 OpenConfiguratorCli::GetInstance().networkName,
+				                 nodeId,
+				                 parameterGroup.attributes.at(0),								/** uniqueID */
+				                 parameterRef.at(0),											/** uniqueIDRef */
+				                 parameterRef.at(2),  											/** actualValue */
+				                 bitoffset, 													/** bitOffset */
+				                 interfaceId, modId, modPosition);
+				if (!res.IsSuccessful())
+				{
+					return CliLogger::GetInstance().GetFailureErrorString(res);
 				}
 			}
 		}
@@ -1397,36 +1198,41 @@ CliResult ProjectParser::CreateParameterGroup(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::CreateParameterList(const ParserElement& element,
+CliResult ProjectParser::CreateParameterList(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId,
         const std::string& interfaceId,
         const std::string& modId,
         const std::uint32_t modPosition)
 {
-	ParserResult pResult;
-
-	CliResult crres = pResult.CreateResult(element,
-	                                       kParameterXpathExpression,
-	                                       kFormatStrParameterXpathExpression);
+	CliResult crres = deviceTemplate.parameterResult;
 	if (!crres.IsSuccessful())
 	{
 		LOG_WARN() << CliLogger::GetInstance().GetErrorString(crres);
 	}
 	else
 	{
-		for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+		for (const XdcParameterType& parameter : deviceTemplate.parameters)
 		{
-			ParameterAccess access = GetParameterAccess(pResult.parameters[row].at(1));
-			IEC_Datatype data = GetIecDataType(pResult.node.at(row));
+			ParameterAccess access = ParameterAccess::undefined;
+			if (!EnumConverter::ToParameterAccess(parameter.attributes.at(1), access))
+			{
+				return NumberConverter::GetConversionError(parameter.attributes.at(1));
+			}
 
-			if (!pResult.parameters[row].at(2).empty())		/** Is templateIDRef not empty */
+			if (!parameter.attributes.at(2).empty())		/** Is templateIDRef not empty */
 			{
+				CliResult refres = CheckParameterRef(deviceTemplate, parameter.attributes.at(2), true);
+				if (!refres.IsSuccessful())
+				{
+					return refres;
+				}
+
 				Result res = OpenConfiguratorCore::GetInstance().CreateParameter(
 				                 OpenConfiguratorCli::GetInstance().networkName,
 				                 nodeId,
-				                 pResult.parameters[row].at(0), 		/** uniqueID */
+				                 parameter.attributes.at(0), 		/** uniqueID */
 				                 access,
-				                 pResult.parameters[row].at(2),		/** templateIDRef */
+				                 parameter.attributes.at(2),		/** templateIDRef */
 				                 interfaceId,
 				                 modId,
 				                 modPosition);
@@ -1437,19 +1243,15 @@ CliResult ProjectParser::CreateParameterList(const ParserElement& element,
 			}
 			else
 			{
-				ParserResult subpResult;
-
-				CliResult subcrres = subpResult.CreateResult(element, kParameterDataTypeIdRefXpathExpression,
-				                     kFormatStrAppLayerInterfaceXpathExpression,
-				                     pResult.node.at(row));
+				CliResult subcrres = parameter.dataTypeIdRefResult;
 				if (!subcrres.IsSuccessful())
 				{
 					/** DataTypeIdRef not available */
 					Result res = OpenConfiguratorCore::GetInstance().CreateParameter(
 					                 OpenConfiguratorCli::GetInstance().networkName,
 					                 nodeId,
-					                 pResult.parameters[row].at(0),		/** UniqueID */
-					                 access,	data,
+					                 parameter.attributes.at(0),		/** UniqueID */
+					                 access,	parameter.dataType,
 					                 false, interfaceId,
 					                 modId, modPosition);
 					if (!res.IsSuccessful())
@@ -1459,16 +1261,14 @@ CliResult ProjectParser::CreateParameterList(const ParserElement& element,
 				}
 				else
 				{
-					for (std::uint32_t subrow = 0; subrow < subpResult.parameters.size(); subrow++)
+					for (const std::vector<std::string>& dataTypeIdRef : parameter.dataTypeIdRefs)
 					{
-						ParameterAccess paramAccess = GetParameterAccess(pResult.parameters[row].at(1));
-
 						Result res = OpenConfiguratorCore::GetInstance().CreateParameter(
 						                 OpenConfiguratorCli::GetInstance().networkName,
 						                 nodeId,
-						                 pResult.parameters[row].at(0),					/** uniqueID */
-						                 subpResult.parameters[subrow].at(0),			/** uniqueID of subresult */
-						                 paramAccess,
+						                 parameter.attributes.at(0),					/** uniqueID */
+						                 dataTypeIdRef.at(0),							/** uniqueID of subresult */
+						                 access,
 						                 false,
 						                 interfaceId,
 						                 modId,
@@ -1481,39 +1281,9 @@ CliResult ProjectParser::CreateParameterList(const ParserElement& element,
 				}
 			}
 
-			CliResult subcrres;
-
-			/** Updates the allowed values of parameter.*/
-			subcrres = SetParamAllowedValue(element, nodeId, pResult.node.at(row),
-			                                pResult.parameters[row].at(0), interfaceId,
-			                                modId, modPosition);
-			if (!subcrres.IsSuccessful())
-			{
-				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
-			}
-
-			/** Updates the allowed range of parameter.*/
-			subcrres = SetParamAllowedRange(element, nodeId, pResult.node.at(row),
-			                                pResult.parameters[row].at(0), interfaceId,
-			                                modId, modPosition);
-			if (!subcrres.IsSuccessful())
-			{
-				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
-			}
-
-			/** Updates the default value of parameter.*/
-			subcrres = SetParamDefaultValue(element, nodeId, pResult.node.at(row),
-			                                pResult.parameters[row].at(0), interfaceId,
-			                                modId, modPosition);
-			if (!subcrres.IsSuccessful())
-			{
-				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
-			}
-
-			/** Updates the actual value of parameter.*/
-			subcrres = SetParamActualValue(element, nodeId, pResult.node.at(row),
-			                               pResult.parameters[row].at(0), interfaceId,
-			                               modId, modPosition);
+			/** Updates the allowed, default and actual values of parameter.*/
+			CliResult subcrres = SetParamValues(parameter, nodeId, interfaceId,
+			                                    modId, modPosition);
 			if (!subcrres.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
@@ -1524,7 +1294,7 @@ CliResult ProjectParser::CreateParameterList(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::ImportProfileBodyDevice(const ParserElement& element,
+CliResult ProjectParser::ImportProfileBodyDevice(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId,
         const std::string& interfaceId,
         const std::string& modId,
@@ -1533,28 +1303,28 @@ CliResult ProjectParser::ImportProfileBodyDevice(const ParserElement& element,
 	CliResult subcrres;
 
 	/** Creates datatype in the core library */
-	subcrres = CreateDataType(element, nodeId, interfaceId, modId, modPosition);
+	subcrres = CreateDataType(deviceTemplate, nodeId, interfaceId, modId, modPosition);
 	if (!subcrres.IsSuccessful())
 	{
 		LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
 	}
 
 	/** Creates parameter template of node into the core library */
-	subcrres = CreateParameterTemplate(element, nodeId, interfaceId, modId, modPosition);
+	subcrres = CreateParameterTemplate(deviceTemplate, nodeId, interfaceId, modId, modPosition);
 	if (!subcrres.IsSuccessful())
 	{
 		LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
 	}
 
 	/** Creates parameter list of node into the core library */
-	subcrres = CreateParameterList(element, nodeId, interfaceId, modId, modPosition);
+	subcrres = CreateParameterList(deviceTemplate, nodeId, interfaceId, modId, modPosition);
 	if (!subcrres.IsSuccessful())
 	{
 		LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
 	}
 
 	/** Creates parameter Group of node into the core library */
-	subcrres = CreateParameterGroup(element, nodeId, interfaceId, modId, modPosition);
+	subcrres = CreateParameterGroup(deviceTemplate, nodeId, interfaceId, modId, modPosition);
 	if (!subcrres.IsSuccessful())
 	{
 		LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
@@ -1563,28 +1333,25 @@ CliResult ProjectParser::ImportProfileBodyDevice(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::CreateDynamicChannels(const ParserElement& element,
+CliResult ProjectParser::CreateDynamicChannels(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId)
 {
-	ParserResult pResult;
-
-	CliResult crres = pResult.CreateResult(element, kDynamicChnlXpathExpression,
-	                                       kFormatStrDynamicChnlXpathExpressionModule);
+	CliResult crres = deviceTemplate.dynamicChannelResult;
 	if (!crres.IsSuccessful())
 	{
 		LOG_WARN() << CliLogger::GetInstance().GetErrorString(crres);
 	}
 	else
 	{
-		for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+		for (const std::vector<std::string>& dynamicChannel : deviceTemplate.dynamicChannels)
 		{
-			std::string dataType = pResult.parameters[row].at(0);
-			std::string accessType = pResult.parameters[row].at(1);
-			std::string startIndex = pResult.parameters[row].at(2);
-			std::string endIndex = pResult.parameters[row].at(3);
-			std::string maxNumber = pResult.parameters[row].at(4);
-			std::string addressOfset = pResult.parameters[row].at(5);
-			std::string bitAlignment = pResult.parameters[row].at(6);
+			std::string dataType = dynamicChannel.at(0);
+			std::string accessType = dynamicChannel.at(1);
+			std::string startIndex = dynamicChannel.at(2);
+			std::string endIndex = dynamicChannel.at(3);
+			std::string maxNumber = dynamicChannel.at(4);
+			std::string addressOfset = dynamicChannel.at(5);
+			std::string bitAlignment = dynamicChannel.at(6);
 
 			std::uint32_t start = 0;
 			std::uint32_t end = 0;
@@ -1592,32 +1359,44 @@ CliResult ProjectParser::CreateDynamicChannels(const ParserElement& element,
 			std::uint32_t ofset = 0;
 			std::uint8_t bitLign = 0;
 
-			if (!startIndex.empty())
+			if (!NumberConverter::ToUInt32(startIndex, 16, start))
 			{
-				start = (std::uint32_t)std::stol(startIndex, NULL, 16);
+				return NumberConverter::GetConversionError(startIndex);
 			}
-			if (!endIndex.empty())
+			if (!NumberConverter::ToUInt32(endIndex, 16, end))
 			{
-				end = (std::uint32_t)std::stol(endIndex, NULL, 16);
+				return NumberConverter::GetConversionError(endIndex);
 			}
-			if (!maxNumber.empty())
+			if (!NumberConverter::ToUInt32(maxNumber, 16, mxNumber))
 			{
-				mxNumber = (std::uint32_t)std::stol(maxNumber, NULL, 16);
+				return NumberConverter::GetConversionError(maxNumber);
 			}
-			if (!addressOfset.empty())
+			if (!NumberConverter::ToUInt32(addressOfset, 16, ofset))
 			{
-				ofset = (std::uint32_t)std::stol(addressOfset, NULL, 16);
+				return NumberConverter::GetConversionError(addressOfset);
 			}
-			if (!bitAlignment.empty())
+			if (!NumberConverter::ToUInt8(bitAlignment, 16, bitLign))
 			{
-				bitLign = (std::uint8_t)std::stol(bitAlignment, NULL, 16);
+				return NumberConverter::GetConversionError(bitAlignment);
+			}
+
+			std::uint32_t plkDataType = (std::uint32_t) PlkDataType::UNDEFINED;
+			if (!NumberConverter::ToUInt32(dataType, 16, plkDataType))
+			{
+				return NumberConverter::GetConversionError(dataType);
+			}
+
+			DynamicChannelAccessType channelAccessType = DynamicChannelAccessType::UNDEFINED;
+			if (!EnumConverter::ToDynamicChannelAccessType(accessType, channelAccessType))
+			{
+				return NumberConverter::GetConversionError(accessType);
 			}
 
 			Result res = OpenConfiguratorCore::GetInstance().CreateDynamicChannel(
 			                 OpenConfiguratorCli::GetInstance().networkName,
 			                 nodeId,
-			                 GetPlkDataType(dataType),
-			                 GetDynamicChannelAccessType(accessType),
+			                 (PlkDataType) plkDataType,
+			                 channelAccessType,
 			                 start,
 			                 end,
 			                 mxNumber,
@@ -1633,136 +1412,127 @@ CliResult ProjectParser::CreateDynamicChannels(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::CreateObject(const ParserElement& element,
+CliResult ProjectParser::CreateObject(const DeviceTemplate& deviceTemplate,
                                       const std::uint8_t nodeId,
-                                      const std::vector<std::string>& forcedObject,
-                                      const std::vector<std::string>& forcedSubObject)
+                                      const std::unordered_set<std::uint64_t>& forcedObjects)
 {
 	try
 	{
-		ParserResult pResult;
-
-		CliResult crres = pResult.CreateResult(element, kObjectXpathExpression,
-		                                       kFormatStrObjectXpathExpression);
+		CliResult crres = deviceTemplate.objectResult;
 		if (!crres.IsSuccessful())
 		{
 			LOG_WARN() << CliLogger::GetInstance().GetErrorString(crres);
 		}
 		else
 		{
-			for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+			for (const XdcObjectType& object : deviceTemplate.objects)
 			{
-				std::uint32_t objId = 0;
-				std::uint8_t objIdType = 0;
-
-				if (!pResult.parameters[row].at(0).empty())
-				{
-					objId = (std::uint32_t)std::stol(pResult.parameters[row].at(0), NULL, 16);
-				}
-				if (!pResult.parameters[row].at(2).empty())
+				const XdcObjectEntryType& objEntry = object.entry;
+				CliResult convres = objEntry.conversionResult;
+				if (!convres.IsSuccessful())
 				{
-					objIdType = (std::uint8_t)std::stoi(pResult.parameters[row].at(2));
+					return convres;
 				}
-				std::string accessType = pResult.parameters[row].at(5);
-				std::string dataType = pResult.parameters[row].at(4);
-				std::string uniqueIdRef = pResult.parameters[row].at(8);
-				std::string actualValue = pResult.parameters[row].at(7);
 
-				if ((accessType.compare("ro") == 0) ||
-				        (accessType.compare("const") == 0))
+				/** The referenced parameter is resolved through the uniqueID index of the XDC */
+				if (!objEntry.uniqueIdRef.empty())
 				{
-					actualValue = "";
+					convres = CheckParameterRef(deviceTemplate, objEntry.uniqueIdRef, false);
+					if (!convres.IsSuccessful())
+					{
+						return convres;
+					}
 				}
 
-				if ((!dataType.empty()) && (uniqueIdRef.empty()))
+				if (objEntry.hasDataType && (objEntry.uniqueIdRef.empty()))
 				{
 					Result res = OpenConfiguratorCore::GetInstance().CreateObject(
 					                 OpenConfiguratorCli::GetInstance().networkName,
-					                 nodeId, objId,
-					                 GetObjectType(objIdType),
-					                 pResult.parameters[row].at(1),					/** name */
-					                 GetPlkDataType(dataType),
-					                 GetObjAccessType(accessType),
-					                 GetPdoMapping(pResult.parameters[row].at(6)), 	/** PDOmapping */
-					                 pResult.parameters[row].at(3),					/** defaultValue */
-					                 actualValue);
+					                 nodeId, objEntry.index,
+					                 objEntry.objectType,
+					                 objEntry.name,
+					                 objEntry.dataType,
+					                 objEntry.accessType,
+					                 objEntry.pdoMapping,
+					                 objEntry.defaultValue,
+					                 objEntry.actualValue);
 					if (!res.IsSuccessful())
 					{
 						return CliLogger::GetInstance().GetFailureErrorString(res);
 					}
 
-					if ((!pResult.parameters[row].at(9).empty()) || (!pResult.parameters[row].at(10).empty()))
+					if ((!objEntry.lowLimit.empty()) || (!objEntry.highLimit.empty()))
 					{
 						res = OpenConfiguratorCore::GetInstance().SetObjectLimits(
 						          OpenConfiguratorCli::GetInstance().networkName,
-						          nodeId, objId,
-						          pResult.parameters[row].at(9),				/** lowLimit */
-						          pResult.parameters[row].at(10));			/** highLimit */
+						          nodeId, objEntry.index,
+						          objEntry.lowLimit,
+						          objEntry.highLimit);
 						if (!res.IsSuccessful())
 						{
 							return CliLogger::GetInstance().GetFailureErrorString(res);
 						}
 					}
 				}
-				else if ((!dataType.empty()) && (!uniqueIdRef.empty()))
+				else if (objEntry.hasDataType && (!objEntry.uniqueIdRef.empty()))
 				{
 					Result res = OpenConfiguratorCore::GetInstance().CreateParameterObject(
 					                 OpenConfiguratorCli::GetInstance().networkName,
-					                 nodeId, objId, GetObjectType(objIdType),
-					                 pResult.parameters[row].at(1),					/** name */
-					                 GetPlkDataType(dataType),
-					                 GetObjAccessType(accessType),
-					                 GetPdoMapping(pResult.parameters[row].at(6)), 	/** PDOmapping */
-					                 uniqueIdRef,
-					                 pResult.parameters[row].at(3),					/** defaultValue */
-					                 actualValue);
+					                 nodeId, objEntry.index, objEntry.objectType,
+					                 objEntry.name,
+					                 objEntry.dataType,
+					                 objEntry.accessType,
+					                 objEntry.pdoMapping,
+					                 objEntry.uniqueIdRef,
+					                 objEntry.defaultValue,
+					                 objEntry.actualValue);
 					if (!res.IsSuccessful())
 					{
 						return CliLogger::GetInstance().GetFailureErrorString(res);
 					}
 				}
-				else if ((dataType.empty()) && (!uniqueIdRef.empty()))
+				else if ((!objEntry.hasDataType) && (!objEntry.uniqueIdRef.empty()))
 				{
 					Result res = OpenConfiguratorCore::GetInstance().CreateParameterObject(
 					                 OpenConfiguratorCli::GetInstance().networkName,
-					                 nodeId, objId,
-					                 GetObjectType(objIdType),
-					                 pResult.parameters[row].at(1),					/** name */
+					                 nodeId, objEntry.index,
+					                 objEntry.objectType,
+					                 objEntry.name,
 					                 PlkDataType::UNDEFINED,
-					                 GetObjAccessType(accessType),
-					                 GetPdoMapping(pResult.parameters[row].at(6)), 	/** PDOmapping */
-					                 uniqueIdRef,
-					                 pResult.parameters[row].at(3),					/** defaultValue */
-					                 actualValue);
+					                 objEntry.accessType,
+					                 objEntry.pdoMapping,
+					                 objEntry.uniqueIdRef,
+					                 objEntry.defaultValue,
+					                 objEntry.actualValue);
 					if (!res.IsSuccessful())
 					{
 						return CliLogger::GetInstance().GetFailureErrorString(res);
 					}
 
 				}
-				else if ((dataType.empty()) && (uniqueIdRef.empty()))
+				else if ((!objEntry.hasDataType) && (objEntry.uniqueIdRef.empty()))
 				{
 					Result res = OpenConfiguratorCore::GetInstance().CreateObject(
 					                 OpenConfiguratorCli::GetInstance().networkName,
-					                 nodeId, objId, GetObjectType(objIdType),
-					                 pResult.parameters[row].at(1),					/** name */
-					                 GetPlkDataType(dataType),
-					                 GetObjAccessType(accessType),
-					                 GetPdoMapping(pResult.parameters[row].at(6)), 	/** PDOmapping */
-					                 pResult.parameters[row].at(3),					/** defaultValue */
-					                 actualValue);
+					                 nodeId, objEntry.index, objEntry.objectType,
+					                 objEntry.name,
+					                 PlkDataType::UNDEFINED,
+					                 objEntry.accessType,
+					                 objEntry.pdoMapping,
+					                 objEntry.defaultValue,
+					                 objEntry.actualValue);
 					if (!res.IsSuccessful())
 					{
 						return CliLogger::GetInstance().GetFailureErrorString(res);
 					}
 
-					if ((!pResult.parameters[row].at(9).empty()) || (!pResult.parameters[row].at(10).empty()))
+					if ((!objEntry.lowLimit.empty()) || (!objEntry.highLimit.empty()))
 					{
 						res = OpenConfiguratorCore::GetInstance().SetObjectLimits(
 						          OpenConfiguratorCli::GetInstance().networkName,
-						          nodeId, objId,
-						          pResult.parameters[row].at(9),			/** lowLimit */
-						          pResult.parameters[row].at(10));		/** highLimit */
+						          nodeId, objEntry.index,
+						          objEntry.lowLimit,
+						          objEntry.highLimit);
 						if (!res.IsSuccessful())
 						{
 							return CliLogger::GetInstance().GetFailureErrorString(res);
@@ -1770,114 +1540,104 @@ CliResult ProjectParser::CreateObject(const ParserElement& element,
 					}
 				}
 
-				ParserResult subpResult;
-
-				CliResult subcrres = subpResult.CreateResult(element, kSubObjectXpathExpression,
-				                     kFormatStrSubObjectXpathExpression,
-				                     pResult.node.at(row));
+				CliResult subcrres = object.subObjectResult;
 				if (!subcrres.IsSuccessful())
 				{
 					LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
 				}
 				else
 				{
-					for (std::uint32_t subrow = 0; subrow < subpResult.parameters.size(); subrow++)
+					for (const XdcObjectEntryType& subObject : object.subObjects)
 					{
-						std::uint8_t subObjId = 0;
-						std::uint8_t subObjIdType = 0;
-
-						if (!subpResult.parameters[subrow].at(0).empty())
+						CliResult convres = subObject.conversionResult;
+						if (!convres.IsSuccessful())
 						{
-							subObjId = (std::uint8_t)std::stol(subpResult.parameters[subrow].at(0), NULL, 16);
+							return convres;
 						}
-						if (!subpResult.parameters[subrow].at(2).empty())
-						{
-							subObjIdType = (std::uint8_t)std::stoi(subpResult.parameters[subrow].at(2));
-						}
-						std::string subObjaccessType = subpResult.parameters[subrow].at(5);
-						std::string subObjActualValue = subpResult.parameters[subrow].at(7);
-						std::string subObjuniqueIdRef = subpResult.parameters[subrow].at(8);
-						std::string subObjdataType = subpResult.parameters[subrow].at(4);
 
-						if ((subObjaccessType.compare("ro") == 0) ||
-						        (subObjaccessType.compare("const") == 0))
+						/** The referenced parameter is resolved through the uniqueID index of the XDC */
+						if (!subObject.uniqueIdRef.empty())
 						{
-							subObjActualValue = "";
+							convres = CheckParameterRef(deviceTemplate, subObject.uniqueIdRef, false);
+							if (!convres.IsSuccessful())
+							{
+								return convres;
+							}
 						}
 
-						if (subpResult.parameters[subrow].at(8).empty())						/** Is uniqueIdRef empty */
+						std::uint8_t subObjId = (std::uint8_t)subObject.index;
+
+						if (subObject.uniqueIdRef.empty())
 						{
 							Result res = OpenConfiguratorCore::GetInstance().CreateSubObject(
 							                 OpenConfiguratorCli::GetInstance().networkName,
-							                 nodeId, objId, subObjId, GetObjectType(subObjIdType),
-							                 subpResult.parameters[subrow].at(1),					/** sub object name */
-							                 GetPlkDataType(subpResult.parameters[subrow].at(4)), 	/** sub object dataType */
-							                 GetObjAccessType(subObjaccessType),
-							                 GetPdoMapping(subpResult.parameters[subrow].at(6)),		/** sub object PDOmapping */
-							                 subpResult.parameters[subrow].at(3),					/** sub object defaultValue */
-							                 subObjActualValue);
+							                 nodeId, objEntry.index, subObjId, subObject.objectType,
+							                 subObject.name,
+							                 subObject.dataType,
+							                 subObject.accessType,
+							                 subObject.pdoMapping,
+							                 subObject.defaultValue,
+							                 subObject.actualValue);
 							if (!res.IsSuccessful())
 							{
 								return CliLogger::GetInstance().GetFailureErrorString(res);
 							}
 
 							/** If any one of the sub object lowLimit and highLimit has values */
-							if ((!subpResult.parameters[subrow].at(9).empty()) || (!subpResult.parameters[subrow].at(10).empty()))
+							if ((!subObject.lowLimit.empty()) || (!subObject.highLimit.empty()))
 							{
 								res = OpenConfiguratorCore::GetInstance().SetSubObjectLimits(
 								          OpenConfiguratorCli::GetInstance().networkName,
-								          nodeId, objId, subObjId,
-								          subpResult.parameters[subrow].at(9),			/** sub object lowLimit */
-								          subpResult.parameters[subrow].at(10));			/** sub object highLimit */
+								          nodeId, objEntry.index, subObjId,
+								          subObject.lowLimit,
+								          subObject.highLimit);
 								if (!res.IsSuccessful())
 								{
 									return CliLogger::GetInstance().GetFailureErrorString(res);
 								}
 							}
 						}
-						else if ((!subObjuniqueIdRef.empty()) && (!subObjdataType.empty()))
+						else if (subObject.hasDataType)
 						{
 							/** Both sub object uniqueIdRef and dataType has values */
 							Result res = OpenConfiguratorCore::GetInstance().CreateParameterSubObject(
 							                 OpenConfiguratorCli::GetInstance().networkName,
-							                 nodeId, objId, subObjId,
-							                 GetObjectType(subObjIdType),
-							                 subpResult.parameters[subrow].at(1),					/** sub object name */
-							                 GetPlkDataType(subObjdataType),
-							                 GetObjAccessType(subObjaccessType),
-							                 GetPdoMapping(subpResult.parameters[subrow].at(6)),		/** sub object PDOmapping */
-							                 subObjuniqueIdRef,
-							                 subpResult.parameters[subrow].at(3),					/** sub object defaultValue */
-							                 subObjActualValue);
+							                 nodeId, objEntry.index, subObjId,
+							                 subObject.objectType,
+							                 subObject.name,
+							                 subObject.dataType,
+							                 subObject.accessType,
+							                 subObject.pdoMapping,
+							                 subObject.uniqueIdRef,
+							                 subObject.defaultValue,
+							                 subObject.actualValue);
 							if (!res.IsSuccessful())
 							{
 								return CliLogger::GetInstance().GetFailureErrorString(res);
 							}
 						}
-						else if ((!subObjuniqueIdRef.empty()) && (subObjdataType.empty()))
+						else
 						{
-							/** Both sub object uniqueIdRef and dataType has values */
+							/** Sub object uniqueIdRef without dataType */
 							Result res = OpenConfiguratorCore::GetInstance().CreateParameterSubObject(
 							                 OpenConfiguratorCli::GetInstance().networkName,
-							                 nodeId, objId, subObjId, GetObjectType(subObjIdType),
-							                 subpResult.parameters[subrow].at(1),					/** sub object name */
+							                 nodeId, objEntry.index, subObjId, subObject.objectType,
+							                 subObject.name,
 							                 PlkDataType::UNDEFINED,
-							                 GetObjAccessType(subObjaccessType),
-							                 GetPdoMapping(subpResult.parameters[subrow].at(6)),		/** sub object PDOmapping */
-							                 subObjuniqueIdRef,
-							                 subpResult.parameters[subrow].at(3),					/** sub object defaultValue */
-							                 subObjActualValue);
+							                 subObject.accessType,
+							                 subObject.pdoMapping,
+							                 subObject.uniqueIdRef,
+							                 subObject.defaultValue,
+							                 subObject.actualValue);
 							if (!res.IsSuccessful())
 							{
 								return CliLogger::GetInstance().GetFailureErrorString(res);
 							}
 						}
 
-						CliResult cliRes = 	UpdateForcedObjects(forcedObject, forcedSubObject, nodeId,
-						                                        pResult.parameters[row].at(0),
-						                                        subpResult.parameters[subrow].at(0),
-						                                        objId, subObjId, actualValue,
-						                                        subObjActualValue, false, "", "", 0U);
+						CliResult cliRes = 	UpdateForcedObjects(forcedObjects, nodeId,
+						                                        objEntry.index, subObjId,
+						                                        subObject.actualValue, false, "", "", 0U);
 						if (!cliRes.IsSuccessful())
 						{
 							LOG_WARN() << CliLogger::GetInstance().GetErrorString(cliRes);
@@ -1895,10 +1655,9 @@ CliResult ProjectParser::CreateObject(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::ImportProfileBodyCommn(const ParserElement& element,
+CliResult ProjectParser::ImportProfileBodyCommn(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId,
-        const std::vector<std::string>& forcedObject,
-        const std::vector<std::string>& forcedSubObject,
+        const std::unordered_set<std::uint64_t>& forcedObjects,
         const std::string& interfaceId,
         const std::string& modId,
         const std::uint32_t modPosition)
@@ -1908,8 +1667,7 @@ CliResult ProjectParser::ImportProfileBodyCommn(const ParserElement& element,
 	/** Creates objest in the core library */
 	if (modId.empty())
 	{
-		subcrres = CreateObject(element, nodeId, forcedObject,
-		                        forcedSubObject);
+		subcrres = CreateObject(deviceTemplate, nodeId, forcedObjects);
 		if (!subcrres.IsSuccessful())
 		{
 			LOG_WARN() << CliLogger::GetInstance().GetErrorString(subcrres);
@@ -1917,7 +1675,7 @@ CliResult ProjectParser::ImportProfileBodyCommn(const ParserElement& element,
 	}
 	else
 	{
-		subcrres = CreateModuleObject(element, nodeId, forcedObject, forcedSubObject,
+		subcrres = CreateModuleObject(deviceTemplate, nodeId, forcedObjects,
 		                              interfaceId, modId, modPosition);
 		if (!subcrres.IsSuccessful())
 		{
@@ -1928,28 +1686,24 @@ CliResult ProjectParser::ImportProfileBodyCommn(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::CreateNwMgtGeneralFeatures(const ParserElement& element,
+CliResult ProjectParser::CreateNwMgtGeneralFeatures(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId)
 {
-	ParserResult pResult;
-
-	CliResult crres = pResult.CreateResult(element,
-	                                       kGeneralFeatureXpathExpression,
-	                                       kFormatStrGeneralFeatureXpathExpression);
+	CliResult crres = deviceTemplate.generalFeatureResult;
 	if (!crres.IsSuccessful())
 	{
 		return crres;
 	}
 
-	for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+	for (const std::vector<std::string>& features : deviceTemplate.generalFeatures)
 	{
-		for (std::uint32_t param = 0; param < pResult.parameters[row].size(); param++)
+		for (std::uint32_t param = 0; param < features.size(); param++)
 		{
 			Result res = OpenConfiguratorCore::GetInstance().SetFeatureValue(
 			                 OpenConfiguratorCli::GetInstance().networkName,
 			                 nodeId,
 			                 ((GeneralFeatureEnum) param),
-			                 pResult.parameters[row].at(param));
+			                 features.at(param));
 			if (!res.IsSuccessful())
 			{
 				return CliLogger::GetInstance().GetFailureErrorString(res);
@@ -1960,28 +1714,24 @@ CliResult ProjectParser::CreateNwMgtGeneralFeatures(const ParserElement& element
 	return CliResult();
 }
 
-CliResult ProjectParser::CreateNwMgtMnFeatures(const ParserElement& element,
+CliResult ProjectParser::CreateNwMgtMnFeatures(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId)
 {
-	ParserResult pResult;
-
-	CliResult crres = pResult.CreateResult(element,
-	                                       kMnFeatureXpathExpression,
-	                                       kFormatStrMnFeatureXpathExpression);
+	CliResult crres = deviceTemplate.mnFeatureResult;
 	if (!crres.IsSuccessful())
 	{
 		return crres;
 	}
 
-	for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+	for (const std::vector<std::string>& features : deviceTemplate.mnFeatures)
 	{
-		for (std::uint32_t param = 0; param < pResult.parameters[row].size(); param++)
+		for (std::uint32_t param = 0; param < features.size(); param++)
 		{
 			Result res = OpenConfiguratorCore::GetInstance().SetFeatureValue(
 			                 OpenConfiguratorCli::GetInstance().networkName,
 			                 nodeId,
 			                 (MNFeatureEnum)(param + (std::int32_t) MNFeatureEnum::DLLErrMNMultipleMN),
-			                 pResult.parameters[row].at(param));
+			                 features.at(param));
 			if (!res.IsSuccessful())
 			{
 				return CliLogger::GetInstance().GetFailureErrorString(res);
@@ -1992,28 +1742,24 @@ CliResult ProjectParser::CreateNwMgtMnFeatures(const ParserElement& element,
 	return CliResult();
 }
 
-CliResult ProjectParser::CreateNwMgtCnFeatures(const ParserElement& element,
+CliResult ProjectParser::CreateNwMgtCnFeatures(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId)
 {
-	ParserResult pResult;
-
-	CliResult crres = pResult.CreateResult(element,
-	                                       kCnFeatureXpathExpression,
-	                                       kFormatStrCnFeatureXpathExpression);
+	CliResult crres = deviceTemplate.cnFeatureResult;
 	if (!crres.IsSuccessful())
 	{
 		return crres;
 	}
 
-	for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+	for (const std::vector<std::string>& features : deviceTemplate.cnFeatures)
 	{
-		for (std::uint32_t param = 0; param < pResult.parameters[row].size(); param++)
+		for (std::uint32_t param = 0; param < features.size(); param++)
 		{
 			Result res = OpenConfiguratorCore::GetInstance().SetFeatureValue(
 			                 OpenConfiguratorCli::GetInstance().networkName,
 			                 nodeId,
 			                 (CNFeatureEnum)(param + (std::int32_t) CNFeatureEnum::DLLCNFeatureMultiplex),
-			                 pResult.parameters[row].at(param));
+			                 features.at(param));
 			if (!res.IsSuccessful())
 			{
 				return CliLogger::GetInstance().GetFailureErrorString(res);
@@ -2028,54 +1774,46 @@ CliResult ProjectParser::CreateInterface(const std::uint8_t nodeId,
         const std::string& cnXdc,
         std::uint8_t& maxModulePosition)
 {
-	std::string indexString = kPathSeparator + cnXdc;
-	std::string initialPath = OpenConfiguratorCli::GetInstance().xmlFilePath;
-	std::string nextInitialPath = initialPath.substr(0, initialPath.find_last_of(kPathSeparator));
-	std::string xdcPath = nextInitialPath.append(indexString);
+	std::shared_ptr<const DeviceTemplate> xdcTemplate;
 	CliResult res;
 
 	maxModulePosition = 0;
 
-	/** Validate the XDC file */
-	res = ParameterValidator::GetInstance().IsXdcFileValid(xdcPath);
-	if (!res.IsSuccessful())
-	{
-		/** XDC file is not exists or invalid */
-		return res;
-	}
-
-	ParserElement element(xdcPath, kXdcSchemaDefinitionFileName, kXDDNamespace);
-	CliResult ceres;
-
-	ceres = element.CreateElement();
+	CliResult ceres = GetDeviceTemplate(cnXdc, xdcTemplate);
 	if (!ceres.IsSuccessful())
 	{
 		return ceres;
 	}
 	else
 	{
-		ParserResult pResult;
+		const DeviceTemplate& deviceTemplate = *xdcTemplate;
 
-		res = pResult.CreateResult(element, kInterfaceXdcXpathExpression,
-		                           kFormatStrInterfaceXdcXpathExpression);
+		res = deviceTemplate.interfaceResult;
 		if (!res.IsSuccessful())
 		{
 			return res;
 		}
 
-		for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+		for (const std::vector<std::string>& interfaceRow : deviceTemplate.interfaces)
 		{
 			std::uint32_t maxModules = 0;
 
-			ModuleAddressing modAddress = GetModuleAddressing(pResult.parameters[row].at(2));		/** Module addressing */
-			if (!pResult.parameters[row].at(3).empty())
+			ModuleAddressing modAddress = ModuleAddressing::NEXT;
+			if (!EnumConverter::ToModuleAddressing(interfaceRow.at(2), modAddress))		/** Module addressing */
 			{
-				maxModules = (std::uint32_t)std::stol(pResult.parameters[row].at(3), NULL, 16);		/** Max Modules */
+				return NumberConverter::GetConversionError(interfaceRow.at(2));
+			}
+			if (!interfaceRow.at(3).empty())
+			{
+				if (!NumberConverter::ToUInt32(interfaceRow.at(3), 16, maxModules))		/** Max Modules */
+				{
+					return NumberConverter::GetConversionError(interfaceRow.at(3));
+				}
 				maxModulePosition = (std::uint8_t)maxModules;
 			}
 
 			bool unusedSlot = false;
-			if (pResult.parameters[row].at(4).compare("true") == 0)
+			if (interfaceRow.at(4).compare("true") == 0)
 			{
 				unusedSlot = true;
 			}
@@ -2085,7 +1823,7 @@ CliResult ProjectParser::CreateInterface(const std::uint8_t nodeId,
 			}
 
 			bool multipleMod = false;
-			if (pResult.parameters[row].at(5).compare("true") == 0)
+			if (interfaceRow.at(5).compare("true") == 0)
 			{
 				multipleMod = true;
 			}
@@ -2098,8 +1836,8 @@ CliResult ProjectParser::CreateInterface(const std::uint8_t nodeId,
 			Result result = OpenConfiguratorCore::GetInstance().CreateInterface(
 			                    OpenConfiguratorCli::GetInstance().networkName,
 			                    nodeId,
-			                    pResult.parameters[row].at(0),			/** Interface uniqueId */
-			                    pResult.parameters[row].at(1),			/** Interface type */
+			                    interfaceRow.at(0),			/** Interface uniqueId */
+			                    interfaceRow.at(1),			/** Interface type */
 			                    modAddress,
 			                    maxModules,
 			                    unusedSlot,
@@ -2109,61 +1847,66 @@ CliResult ProjectParser::CreateInterface(const std::uint8_t nodeId,
 				return CliLogger::GetInstance().GetFailureErrorString(result);
 			}
 
-			ParserResult subPresult;
-
-			CliResult cliRes = subPresult.CreateResult(element, kAppLayerInterfaceXpathExpression,
-			                   kFormatStrAppLayerInterfaceXpathExpression);
+			CliResult cliRes = deviceTemplate.appLayerInterfaceResult;
 			if (!cliRes.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(cliRes);
 			}
 			else
 			{
-				for (std::uint32_t line = 0; line < subPresult.parameters.size(); line++)
+				for (const XdcAppLayerInterfaceType& appLayerInterface : deviceTemplate.appLayerInterfaces)
 				{
-					ParserResult subRangeResult;
-
-					CliResult rescli = subRangeResult.CreateResult(element, kInterfaceRangeXpathExpression,
-					                   kFormatStrInterfaceRangeXpathExpression,
-					                   subPresult.node.at(line));
+					CliResult rescli = appLayerInterface.rangeResult;
 					if (!rescli.IsSuccessful())
 					{
 						LOG_WARN() << CliLogger::GetInstance().GetErrorString(rescli);
 					}
 					else
 					{
-						for (std::uint32_t subRow = 0 ; subRow < subRangeResult.parameters.size(); subRow++)
+						for (const std::vector<std::string>& range : appLayerInterface.ranges)
 						{
 							std::uint32_t baseIndex = 0;
 							std::uint32_t maxIndex = 0;
 							std::uint32_t maxSubIndex = 0;
 							std::uint32_t rangeSortStep = 0;
 
-							if (!subRangeResult.parameters[subRow].at(1).empty())
+							if (!NumberConverter::ToUInt32(range.at(1), 16, baseIndex))			/** Base index value */
+							{
+								return NumberConverter::GetConversionError(range.at(1));
+							}
+							if (!NumberConverter::ToUInt32(range.at(2), 16, maxIndex))			/** Max index value */
+							{
+								return NumberConverter::GetConversionError(range.at(2));
+							}
+							if (!NumberConverter::ToUInt32(range.at(3), 16, maxSubIndex))		/** Max Sub index value */
 							{
-								baseIndex = (std::uint32_t)std::stol(subRangeResult.parameters[subRow].at(1), NULL, 16);			/** Base index value */
+								return NumberConverter::GetConversionError(range.at(3));
 							}
-							if (!subRangeResult.parameters[subRow].at(2).empty())
+							SortMode sortmodRange = SortMode::INDEX;
+							if (!EnumConverter::ToSortMode(range.at(4), sortmodRange))			/** Sort mode value */
 							{
-								maxIndex = (std::uint32_t)std::stol(subRangeResult.parameters[subRow].at(2), NULL, 16);			/** Max index value */
+								return NumberConverter::GetConversionError(range.at(4));
 							}
-							if (!subRangeResult.parameters[subRow].at(3).empty())
+							SortNumber sortRangeNumber = SortNumber::CONTINUOUS;
+							if (!EnumConverter::ToSortNumber(range.at(5), sortRangeNumber))		/** Sort number value */
 							{
-								maxSubIndex = (std::uint32_t)std::stol(subRangeResult.parameters[subRow].at(3), NULL, 16);		/** Max Sub index value */
+								return NumberConverter::GetConversionError(range.at(5));
 							}
-							SortMode sortmodRange = GetSortMode(subRangeResult.parameters[subRow].at(4));									/** Sort mode value */
-							SortNumber sortRangeNumber = GetSortNumber(subRangeResult.parameters[subRow].at(5));							/** Sort number value */
-							PDOMapping mapping = GetPdoMapping(subRangeResult.parameters[subRow].at(6));									/** PDO mapping value */
-							if (!subRangeResult.parameters[subRow].at(7).empty())
+							PDOMapping mapping = PDOMapping::UNDEFINED;
+							if (!EnumConverter::ToPdoMapping(range.at(6), mapping))				/** PDO mapping value */
 							{
-								rangeSortStep = (std::uint32_t)std::stol(subRangeResult.parameters[subRow].at(7), NULL, 16);		/** Sort step value */
+								return NumberConverter::GetConversionError(range.at(6));
+							}
+							if (!NumberConverter::ToUInt32(range.at(7), 16, rangeSortStep))		/** Sort step value */
+							{
+								return NumberConverter::GetConversionError(range.at(7));
 							}
 
 							result = OpenConfiguratorCore::GetInstance().CreateRange(
 							             OpenConfiguratorCli::GetInstance().networkName,
 							             nodeId,
-							             subPresult.parameters[line].at(0),					/** Interface uniqueId */
-							             subRangeResult.parameters[subRow].at(0),			/** Range name */
+							             appLayerInterface.attributes.at(0),	/** Interface uniqueId */
+							             range.at(0),							/** Range name */
 							             baseIndex,
 							             maxIndex,
 							             maxSubIndex,
@@ -2185,110 +1928,470 @@ CliResult ProjectParser::CreateInterface(const std::uint8_t nodeId,
 	return CliResult();
 }
 
-CliResult ProjectParser::UpdateNodeIdCollection(const std::uint8_t nodeId,
-        const std::string& cnXdc,
-        const std::vector<std::string>& forcedObject,
-        const std::vector<std::string>& forcedSubObject,
-        const std::string& interfaceId,
-        const std::string& modId,
-        const std::uint32_t modPosition)
+CliResult ProjectParser::UpdateNodeIdCollection(const std::uint8_t nodeId,
+        const std::string& cnXdc,
+        const std::unordered_set<std::uint64_t>& forcedObjects,
+        const std::string& interfaceId,
+        const std::string& modId,
+        const std::uint32_t modPosition)
+{
+	std::shared_ptr<const DeviceTemplate> xdcTemplate;
+	CliResult res;
+
+	CliResult ceres = GetDeviceTemplate(cnXdc, xdcTemplate);
+	if (!ceres.IsSuccessful())
+	{
+		return ceres;
+	}
+	else
+	{
+		const DeviceTemplate& deviceTemplate = *xdcTemplate;
+
+		res = ImportProfileBodyDevice(deviceTemplate, nodeId, interfaceId, modId, modPosition);
+		if (!res.IsSuccessful())
+		{
+			LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+		}
+
+		res = ImportProfileBodyCommn(deviceTemplate, nodeId, forcedObjects,
+		                             interfaceId, modId, modPosition);
+		if (!res.IsSuccessful())
+		{
+			LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+		}
+
+		if (nodeId > MAX_CN_NODE_ID)
+		{
+			res = CreateDynamicChannels(deviceTemplate, nodeId);
+			if (!res.IsSuccessful())
+			{
+				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+			}
+		}
+
+		if (modId.empty())
+		{
+			res = CreateNwMgtGeneralFeatures(deviceTemplate, nodeId);
+			if (!res.IsSuccessful())
+			{
+				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+			}
+
+			res = CreateNwMgtMnFeatures(deviceTemplate, nodeId);
+			if (!res.IsSuccessful())
+			{
+				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+			}
+
+			res = CreateNwMgtCnFeatures(deviceTemplate, nodeId);
+			if (!res.IsSuccessful())
+			{
+				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+			}
+		}
+	}
+
+	return CliResult();
+}
+
+std::string ProjectParser::GetXdcPath(const std::string& xdcFile)
+{
+	std::string indexString = kPathSeparator + xdcFile;
+	std::string initialPath = OpenConfiguratorCli::GetInstance().xmlFilePath;
+	std::string nextInitialPath = initialPath.substr(0, initialPath.find_last_of(kPathSeparator));
+
+	return nextInitialPath.append(indexString);
+}
+
+CliResult ProjectParser::GetDeviceTemplate(const std::string& xdcFile,
+        std::shared_ptr<const DeviceTemplate>& deviceTemplate)
+{
+	try
+	{
+		std::string xdcPath = GetXdcPath(xdcFile);
+
+		/** Validate the XDC file */
+		CliResult res = ParameterValidator::GetInstance().IsXdcFileValid(xdcPath);
+		if (!res.IsSuccessful())
+		{
+			/** XDC file is not exists or invalid */
+			return res;
+		}
+
+		std::string contentKey;
+		res = GetXdcContentKey(xdcPath, contentKey);
+		if (!res.IsSuccessful())
+		{
+			return res;
+		}
+
+		/** A failed validation of any file cancels the import */
+		if (validateInBackground)
+		{
+			res = schemaValidator.GetFailure();
+			if (!res.IsSuccessful())
+			{
+				return res;
+			}
+		}
+
+		/** Nodes sharing the same XDC content share one device template */
+		std::shared_ptr<const DeviceTemplate> xdcTemplate;
+		CliResult extres;
+		bool isClaimed = false;
+		{
+			std::unique_lock<std::mutex> lock(templateMutex);
+
+			while (true)
+			{
+				std::map<std::string, std::shared_ptr<const DeviceTemplate>>::const_iterator it = deviceTemplateCache.find(contentKey);
+				if (it != deviceTemplateCache.end())
+				{
+					xdcTemplate = it->second;
+					break;
+				}
+
+				/** A failure of a prefetch worker is reported as is, without extracting the file again */
+				std::map<std::string, CliResult>::const_iterator failureIt = deviceTemplateFailures.find(contentKey);
+				if (failureIt != deviceTemplateFailures.end())
+				{
+					extres = failureIt->second;
+					break;
+				}
+
+				if (claimedContentKeys.insert(contentKey).second)
+				{
+					isClaimed = true;
+					break;
+				}
+
+				/** A prefetch worker is extracting the file */
+				templateCompleted.wait(lock);
+			}
+		}
+
+		if (isClaimed)
+		{
+			extres = ExtractDeviceTemplate(xdcPath, xdcTemplate);
+			CompleteDeviceTemplate(contentKey, xdcTemplate, extres);
+		}
+
+		/** The template was extracted optimistically, it is used for a valid file only */
+		if (validateInBackground)
+		{
+			res = schemaValidator.Wait(xdcPath, kXdcSchemaDefinitionFileName, kXDDNamespace);
+			if (!res.IsSuccessful())
+			{
+				return res;
+			}
+		}
+
+		if (!extres.IsSuccessful())
+		{
+			return extres;
+		}
+
+		deviceTemplate = xdcTemplate;
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
+
+CliResult ProjectParser::GetXdcContentKey(const std::string& xdcPath,
+        std::string& contentKey)
+{
+	try
+	{
+		/** A changed file on disk gets a new key and is hashed again */
+		std::ostringstream pathKey;
+		pathKey << boost::filesystem::canonical(xdcPath).string()
+		        << "|" << boost::filesystem::last_write_time(xdcPath)
+		        << "|" << boost::filesystem::file_size(xdcPath);
+
+		{
+			std::lock_guard<std::mutex> lock(templateMutex);
+
+			std::map<std::string, std::string>::const_iterator it = xdcContentKeys.find(pathKey.str());
+			if (it != xdcContentKeys.end())
+			{
+				contentKey = it->second;
+				return CliResult();
+			}
+		}
+
+		CliResult res = DeviceTemplateParser::GetInstance().GetContentKey(xdcPath, contentKey);
+		if (!res.IsSuccessful())
+		{
+			return res;
+		}
+
+		std::lock_guard<std::mutex> lock(templateMutex);
+		xdcContentKeys.insert(std::make_pair(pathKey.str(), contentKey));
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
+
+CliResult ProjectParser::ExtractDeviceTemplate(const std::string& xdcPath,
+        std::shared_ptr<const DeviceTemplate>& deviceTemplate)
+{
+	try
+	{
+		/** The document is only needed until its template is extracted,
+		    with several jobs the XDC is validated separately */
+		ParserElement element(xdcPath, kXdcSchemaDefinitionFileName, kXDDNamespace, true);
+
+		CliResult res;
+		if (validateInBackground)
+		{
+			res = element.CreateUnvalidatedElement();
+		}
+		else
+		{
+			res = element.CreateElement();
+		}
+		if (!res.IsSuccessful())
+		{
+			return res;
+		}
+
+		std::shared_ptr<DeviceTemplate> xdcTemplate = std::make_shared<DeviceTemplate>();
+		res = DeviceTemplateParser::GetInstance().CreateDeviceTemplate(element, *xdcTemplate);
+		if (!res.IsSuccessful())
+		{
+			return res;
+		}
+
+		deviceTemplate = xdcTemplate;
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+	catch (...)
+	{
+		/** Xerces exceptions do not derive from std::exception */
+		return GetExtractionFailure(xdcPath);
+	}
+
+	return CliResult();
+}
+
+CliResult ProjectParser::GetExtractionFailure(const std::string& xdcPath)
+{
+	boost::format formatter(kMsgDeviceTemplateNotExtracted[CliLogger::GetInstance().languageIndex]);
+	formatter % xdcPath;
+
+	return CliResult(CliErrorCode::FAILURE, formatter.str());
+}
+
+CliResult ProjectParser::CollectXdcPaths(const ParserElement& element,
+        std::vector<std::string>& xdcPaths)
+{
+	try
+	{
+		/** Collect the distinct XDC files of all nodes and modules */
+		const std::string xPathExpressions[] = { kMnXpathExpression, kRmnXpathExpression, kCnXpathExpression, kAllModulesXpathExpression };
+		const std::string formatStrings[] = { kFormatStrMnXpathExpression, kFormatStrRmnXpathExpression, kFormatStrCnXpathExpression, kFormatStrModuleXpathExpression };
+		const std::uint32_t pathColumns[] = { 1, 1, 1, 3 };
+
+		std::set<std::string> xdcPathSet;
+		std::vector<std::pair<std::uintmax_t, std::string>> xdcFiles;
+
+		for (std::uint32_t query = 0; query < 4; query++)
+		{
+			ParserResult pResult;
+
+			CliResult crres = pResult.CreateResult(element, xPathExpressions[query], formatStrings[query]);
+			if (!crres.IsSuccessful())
+			{
+				continue;
+			}
+
+			for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+			{
+				std::string xdcPath = GetXdcPath(pResult.parameters[row].at(pathColumns[query]));
+
+				/** Invalid files are reported by the import of their node */
+				CliResult res = ParameterValidator::GetInstance().IsXdcFileValid(xdcPath);
+				if (res.IsSuccessful() && xdcPathSet.insert(xdcPath).second)
+				{
+					xdcFiles.push_back(std::make_pair(boost::filesystem::file_size(xdcPath), xdcPath));
+				}
+			}
+		}
+
+		/** Largest files first, so that no large file is started last */
+		std::sort(xdcFiles.begin(), xdcFiles.end(), std::greater<std::pair<std::uintmax_t, std::string>>());
+
+		xdcPaths.clear();
+		for (const std::pair<std::uintmax_t, std::string>& xdcFile : xdcFiles)
+		{
+			xdcPaths.push_back(xdcFile.second);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
+
+CliResult ProjectParser::PrefetchDeviceTemplates(const std::vector<std::string>& xdcPaths)
+{
+	try
+	{
+		std::uint32_t jobCount = OpenConfiguratorCli::GetInstance().jobCount;
+		if ((jobCount <= 1) || xdcPaths.empty())
+		{
+			return CliResult();
+		}
+
+		/** The grammar pool is locked by the validation for the whole import */
+		prefetchPaths = xdcPaths;
+		nextPrefetchPath = 0;
+		prefetchStopped = false;
+
+		/** The workers share the thread budget with the object chunks of large XDCs */
+		std::size_t workerCount = DeviceTemplateParser::GetInstance().ReserveThreads(std::min<std::size_t>(jobCount, xdcPaths.size()));
+		for (std::size_t worker = 0; worker < workerCount; worker++)
+		{
+			try
+			{
+				prefetchWorkers.push_back(std::thread(&ProjectParser::PrefetchWorker, this));
+			}
+			catch (const std::system_error&)
+			{
+				/** Continue with the workers started so far, the import extracts the rest */
+				DeviceTemplateParser::GetInstance().ReleaseThreads(workerCount - worker);
+				break;
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
+
+void ProjectParser::StopPrefetch()
 {
-	std::string indexString = kPathSeparator + cnXdc;
-	std::string initialPath = OpenConfiguratorCli::GetInstance().xmlFilePath;
-	std::string nextInitialPath = initialPath.substr(0, initialPath.find_last_of(kPathSeparator));
-	std::string xdcPath = nextInitialPath.append(indexString);
-	CliResult res;
+	prefetchStopped = true;
 
-	/** Validate the XDC file */
-	res = ParameterValidator::GetInstance().IsXdcFileValid(xdcPath);
-	if (!res.IsSuccessful())
+	for (std::thread& worker : prefetchWorkers)
 	{
-		/** XDC file is not exists or invalid */
-		return res;
+		worker.join();
 	}
+	prefetchWorkers.clear();
+	prefetchPaths.clear();
+}
 
-	ParserElement element(xdcPath, kXdcSchemaDefinitionFileName, kXDDNamespace);
-	CliResult ceres;
-
-	ceres = element.CreateElement();
-	if (!ceres.IsSuccessful())
-	{
-		return ceres;
-	}
-	else
+void ProjectParser::PrefetchWorker()
+{
+	for (std::size_t index = nextPrefetchPath++; (index < prefetchPaths.size()) && !prefetchStopped; index = nextPrefetchPath++)
 	{
-		res = ImportProfileBodyDevice(element, nodeId, interfaceId, modId, modPosition);
-		if (!res.IsSuccessful())
-		{
-			LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
-		}
-
-		res = ImportProfileBodyCommn(element, nodeId, forcedObject, forcedSubObject,
-		                             interfaceId, modId, modPosition);
-		if (!res.IsSuccessful())
-		{
-			LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
-		}
+		std::string contentKey;
+		bool isClaimed = false;
 
-		if (nodeId > MAX_CN_NODE_ID)
+		try
 		{
-			res = CreateDynamicChannels(element, nodeId);
+			/** Files without a content key are reported by the import of their node */
+			CliResult res = GetXdcContentKey(prefetchPaths.at(index), contentKey);
 			if (!res.IsSuccessful())
 			{
-				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+				continue;
 			}
-		}
 
-		if (modId.empty())
-		{
-			res = CreateNwMgtGeneralFeatures(element, nodeId);
-			if (!res.IsSuccessful())
+			/** Copies of an XDC under different names are extracted once */
 			{
-				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+				std::lock_guard<std::mutex> lock(templateMutex);
+				isClaimed = claimedContentKeys.insert(contentKey).second;
 			}
 
-			res = CreateNwMgtMnFeatures(element, nodeId);
-			if (!res.IsSuccessful())
+			if (!isClaimed)
 			{
-				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+				continue;
 			}
 
-			res = CreateNwMgtCnFeatures(element, nodeId);
-			if (!res.IsSuccessful())
+			/** The result is reported by the import of the first node using the file */
+			std::shared_ptr<const DeviceTemplate> xdcTemplate;
+			res = ExtractDeviceTemplate(prefetchPaths.at(index), xdcTemplate);
+			CompleteDeviceTemplate(contentKey, xdcTemplate, res);
+		}
+		catch (const std::exception& e)
+		{
+			if (isClaimed)
 			{
-				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
+				CompleteDeviceTemplate(contentKey, std::shared_ptr<const DeviceTemplate>(),
+				                       CliLogger::GetInstance().GetFailureErrorString(e));
+			}
+		}
+		catch (...)
+		{
+			/** An exception leaving the thread would terminate the process,
+			    and the import would wait for the claimed file forever */
+			if (isClaimed)
+			{
+				CompleteDeviceTemplate(contentKey, std::shared_ptr<const DeviceTemplate>(),
+				                       GetExtractionFailure(prefetchPaths.at(index)));
 			}
 		}
 	}
 
-	return CliResult();
+	/** Threads of the budget are free for the chunks of the remaining extractions */
+	DeviceTemplateParser::GetInstance().ReleaseThreads(1);
+}
+
+void ProjectParser::CompleteDeviceTemplate(const std::string& contentKey,
+        const std::shared_ptr<const DeviceTemplate>& xdcTemplate,
+        const CliResult& result)
+{
+	{
+		std::lock_guard<std::mutex> lock(templateMutex);
+
+		CliResult res = result;
+		if (res.IsSuccessful() && xdcTemplate)
+		{
+			deviceTemplateCache.insert(std::make_pair(contentKey, xdcTemplate));
+		}
+		else
+		{
+			deviceTemplateFailures.insert(std::make_pair(contentKey, result));
+		}
+	}
+
+	templateCompleted.notify_all();
 }
 
 CliResult ProjectParser::CreateNodeAssignment(const ParserElement& pElement,
         const std::string& xPathExpression,
         const std::uint8_t nodeId)
 {
-	ParserResult pResult;
+	/** The query is evaluated once per project instead of once per node */
+	const NodeAssignmentTable& table = GetNodeAssignmentTable(pElement, xPathExpression);
 
-	CliResult crres = pResult.CreateResult(pElement, xPathExpression,
-	                                       kFormatStrxPathExpression);
+	CliResult crres = table.result;
 	if (!crres.IsSuccessful())
 	{
 		return crres;
 	}
 
-	std::uint32_t row = 0;
-	for (row = 0; row < pResult.parameters.size(); row++)
-	{
-		if (pResult.parameters[row].at(10) == std::to_string(nodeId))
-			break;
-	}
-
 	if (nodeId == MN_DEFAULT_NODE_ID)
 	{
 		CliResult res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_MN_PRES,
 		                                  nodeId,
-		                                  pResult.parameters[0].at(0));	/** TaransmitPres value */
+		                                  table.firstRow.at(0));	/** TaransmitPres value */
 		if (!res.IsSuccessful())
 		{
 			LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
@@ -2324,6 +2427,15 @@ CliResult ProjectParser::CreateNodeAssignment(const ParserElement& pElement,
 		}
 		else
 		{
+			const std::vector<std::string>& nodeRow = table.rows.at(nodeId);
+			if (nodeRow.empty())
+			{
+				boost::format formatter(kMsgNoResultForXPath[CliLogger::GetInstance().languageIndex]);
+				formatter % xPathExpression;
+
+				return CliResult(CliErrorCode::NO_RESULT_FOR_XPATH, formatter.str());
+			}
+
 			CliResult res;
 
 			res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_NODE_IS_CN, nodeId, "true");
@@ -2333,42 +2445,42 @@ CliResult ProjectParser::CreateNodeAssignment(const ParserElement& pElement,
 			}
 
 			res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_MANDATORY_CN,
-			                        nodeId, pResult.parameters[row].at(1));			/** isMandatory value */
+			                        nodeId, nodeRow.at(1));			/** isMandatory value */
 			if (!res.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
 			}
 
 			res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_START_CN,
-			                        nodeId, pResult.parameters[row].at(2));			/** autostartNode value */
+			                        nodeId, nodeRow.at(2));			/** autostartNode value */
 			if (!res.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
 			}
 
 			res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_KEEPALIVE,
-			                        nodeId, pResult.parameters[row].at(3));			/** resetInOperational value */
+			                        nodeId, nodeRow.at(3));			/** resetInOperational value */
 			if (!res.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
 			}
 
 			res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_SWVERSIONCHECK,
-			                        nodeId, pResult.parameters[row].at(4));			/** verifyAppSwVersion value */
+			                        nodeId, nodeRow.at(4));			/** verifyAppSwVersion value */
 			if (!res.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
 			}
 
 			res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_SWUPDATE,
-			                        nodeId, pResult.parameters[row].at(5));			/** autoAppSwUpdateAllowed value */
+			                        nodeId, nodeRow.at(5));			/** autoAppSwUpdateAllowed value */
 			if (!res.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
 			}
 
 			res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_ASYNCONLY_NODE,
-			                        nodeId, pResult.parameters[row].at(7));			/** isAsyncOnly value */
+			                        nodeId, nodeRow.at(7));			/** isAsyncOnly value */
 			if (!res.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
@@ -2387,27 +2499,27 @@ CliResult ProjectParser::CreateNodeAssignment(const ParserElement& pElement,
 			}
 
 			res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_RT1,
-			                        nodeId, pResult.parameters[row].at(8));			/** isType1Router value */
+			                        nodeId, nodeRow.at(8));			/** isType1Router value */
 			if (!res.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
 			}
 
 			res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_RT2,
-			                        nodeId, pResult.parameters[row].at(9));			/** isType2Router value */
+			                        nodeId, nodeRow.at(9));			/** isType2Router value */
 			if (!res.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
 			}
 
 			res = SetNodeAssignment(NodeAssignment::NMT_NODEASSIGN_MULTIPLEXED_CN,
-			                        nodeId, pResult.parameters[row].at(11));			/** isMultiplexed value */
+			                        nodeId, nodeRow.at(11));			/** isMultiplexed value */
 			if (!res.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
 			}
 
-			if (pResult.parameters[row].at(6).compare("true") == 0)					/** isChained value */
+			if (nodeRow.at(6).compare("true") == 0)					/** isChained value */
 			{
 				Result result = OpenConfiguratorCore::GetInstance().SetOperationModeChained(
 				                    OpenConfiguratorCli::GetInstance().networkName, nodeId);
@@ -2422,6 +2534,64 @@ CliResult ProjectParser::CreateNodeAssignment(const ParserElement& pElement,
 	return CliResult();
 }
 
+const NodeAssignmentTable& ProjectParser::GetNodeAssignmentTable(const ParserElement& pElement,
+        const std::string& xPathExpression)
+{
+	std::map<std::string, NodeAssignmentTable>::const_iterator it = nodeAssignmentCache.find(xPathExpression);
+	if (it != nodeAssignmentCache.end())
+	{
+		return it->second;
+	}
+
+	NodeAssignmentTable& table = nodeAssignmentCache[xPathExpression];
+
+	ParserResult pResult;
+	table.result = pResult.CreateResult(pElement, xPathExpression,
+	                                    kFormatStrxPathExpression);
+	if (!table.result.IsSuccessful())
+	{
+		return table;
+	}
+
+	/** Nodes without attributes do not produce a row */
+	if (pResult.parameters.empty())
+	{
+		boost::format formatter(kMsgNoResultForXPath[CliLogger::GetInstance().languageIndex]);
+		formatter % xPathExpression;
+
+		table.result = CliResult(CliErrorCode::NO_RESULT_FOR_XPATH, formatter.str());
+		return table;
+	}
+
+	ParserResultTable::Row firstRow = pResult.parameters[0];
+	for (std::size_t column = 0; column < firstRow.size(); column++)
+	{
+		table.firstRow.push_back(firstRow.at(column));
+	}
+
+	for (std::size_t row = 0; row < pResult.parameters.size(); row++)
+	{
+		ParserResultTable::Row nodeRow = pResult.parameters[row];
+
+		/** Node IDs are matched by their decimal text, the first node with an ID wins */
+		std::uint32_t nodeId = 0;
+		if (!NumberConverter::ToUInt32(nodeRow.at(10), 10, nodeId)
+		        || (nodeId >= kNodeIdCount)
+		        || (nodeRow.at(10) != std::to_string(nodeId))
+		        || !table.rows.at(nodeId).empty())
+		{
+			continue;
+		}
+
+		for (std::size_t column = 0; column < nodeRow.size(); column++)
+		{
+			table.rows.at(nodeId).push_back(nodeRow.at(column));
+		}
+	}
+
+	return table;
+}
+
 CliResult ProjectParser::SetNodeAssignment(const NodeAssignment nodeassign,
         const std::uint8_t nodeId,
         const std::string& value)
@@ -2451,8 +2621,7 @@ CliResult ProjectParser::SetNodeAssignment(const NodeAssignment nodeassign,
 }
 
 CliResult ProjectParser::CreateModule(const std::uint8_t nodeId,
-                                      const std::vector<std::string>& forcedObject,
-                                      const std::vector<std::string>& forcedSubObject,
+                                      const std::unordered_set<std::uint64_t>& forcedObjects,
                                       const std::string& interfacecUId,
                                       const std::string& moduleName,
                                       const std::string& modulePosition,
@@ -2462,85 +2631,77 @@ CliResult ProjectParser::CreateModule(const std::uint8_t nodeId,
 {
 	try
 	{
-		std::string indexString = kPathSeparator + modulePathToXDC;
-		std::string initialPath = OpenConfiguratorCli::GetInstance().xmlFilePath;
-		std::string nextInitialPath = initialPath.substr(0, initialPath.find_last_of(kPathSeparator));
-		std::string xdcPath = nextInitialPath.append(indexString);
+		std::shared_ptr<const DeviceTemplate> xdcTemplate;
 		CliResult res;
 
-		/** Validate the XDC file */
-		res = ParameterValidator::GetInstance().IsXdcFileValid(xdcPath);
-		if (!res.IsSuccessful())
-		{
-			/** XDC file is not exists or invalid */
-			return res;
-		}
-
-		ParserElement element(xdcPath, kXdcSchemaDefinitionFileName, kXDDNamespace);
-		CliResult ceres;
-
-		ceres = element.CreateElement();
+		/** Slots sharing a module XDC share its template, only the slot values differ */
+		CliResult ceres = GetDeviceTemplate(modulePathToXDC, xdcTemplate);
 		if (!ceres.IsSuccessful())
 		{
 			return ceres;
 		}
 
-		ParserResult pResult;
+		const DeviceTemplate& deviceTemplate = *xdcTemplate;
 
-		res = pResult.CreateResult(element, kModuleNodeXpathExpression,
-		                           kFormatStrModuleNodeXpathExpression);
+		res = deviceTemplate.moduleInterfaceResult;
 		if (!res.IsSuccessful())
 		{
 			return res;
 		}
 
-		for (std::uint32_t moduleSubRow = 0; moduleSubRow < pResult.parameters.size(); moduleSubRow++)
+		std::uint32_t modpos = 0;
+		std::uint32_t moduleAdrs = 0;
+
+		if (!NumberConverter::ToUInt32(modulePosition, 16, modpos))
+		{
+			return NumberConverter::GetConversionError(modulePosition);
+		}
+		if (!NumberConverter::ToUInt32(moduleAddress, 16, moduleAdrs))
+		{
+			return NumberConverter::GetConversionError(moduleAddress);
+		}
+
+		for (const std::vector<std::string>& moduleInterface : deviceTemplate.moduleInterfaces)
 		{
 			std::uint8_t minPosition = 0;
 			std::uint8_t maxPosition = maxModulePosition;
 			std::uint8_t minAddress = 0;
 			std::uint8_t maxAddress = maxModulePosition;
 			std::uint8_t maxCount = maxModulePosition;
-			std::uint32_t modpos = 0;
-			std::uint32_t moduleAdrs = 0;
 
-			ModuleAddressing modAddressing = GetModuleAddressing(pResult.parameters[moduleSubRow].at(2));	/** Module addressing */
-			if (!pResult.parameters[moduleSubRow].at(3).empty())
-			{
-				minPosition = (std::uint8_t)std::stoi(pResult.parameters[moduleSubRow].at(3));		/** Module min position */
-			}
-			if (!pResult.parameters[moduleSubRow].at(4).empty())
+			ModuleAddressing modAddressing = ModuleAddressing::NEXT;
+			if (!EnumConverter::ToModuleAddressing(moduleInterface.at(2), modAddressing))	/** Module addressing */
 			{
-				maxPosition = (std::uint8_t)std::stoi(pResult.parameters[moduleSubRow].at(4));		/** Module max position */
+				return NumberConverter::GetConversionError(moduleInterface.at(2));
 			}
-			if (!pResult.parameters[moduleSubRow].at(5).empty())
+			if (!NumberConverter::ToUInt8(moduleInterface.at(3), 10, minPosition))		/** Module min position */
 			{
-				minAddress = (std::uint8_t)std::stoi(pResult.parameters[moduleSubRow].at(5));		/** Module min adress */
+				return NumberConverter::GetConversionError(moduleInterface.at(3));
 			}
-			if (!pResult.parameters[moduleSubRow].at(6).empty())
+			if (!NumberConverter::ToUInt8(moduleInterface.at(4), 10, maxPosition))		/** Module max position */
 			{
-				maxAddress = (std::uint8_t)std::stoi(pResult.parameters[moduleSubRow].at(6));		/** Module max address */
+				return NumberConverter::GetConversionError(moduleInterface.at(4));
 			}
-			if (!pResult.parameters[moduleSubRow].at(7).empty())
+			if (!NumberConverter::ToUInt8(moduleInterface.at(5), 10, minAddress))		/** Module min adress */
 			{
-				maxCount = (std::uint8_t)std::stoi(pResult.parameters[moduleSubRow].at(7));			/** Module max count */
+				return NumberConverter::GetConversionError(moduleInterface.at(5));
 			}
-			if (!modulePosition.empty())
+			if (!NumberConverter::ToUInt8(moduleInterface.at(6), 10, maxAddress))		/** Module max address */
 			{
-				modpos = (std::uint32_t)std::stol(modulePosition, NULL, 16);
+				return NumberConverter::GetConversionError(moduleInterface.at(6));
 			}
-			if (!moduleAddress.empty())
+			if (!NumberConverter::ToUInt8(moduleInterface.at(7), 10, maxCount))			/** Module max count */
 			{
-				moduleAdrs = (std::uint32_t)std::stol(moduleAddress, NULL, 16);
+				return NumberConverter::GetConversionError(moduleInterface.at(7));
 			}
 
 			Result result = OpenConfiguratorCore::GetInstance().CreateModule(OpenConfiguratorCli::GetInstance().networkName,
 			                nodeId,
 			                interfacecUId,
-			                pResult.parameters[moduleSubRow].at(0),		/** Module Child ID */
+			                moduleInterface.at(0),		/** Module Child ID */
 			                modpos,
 			                moduleAdrs,
-			                pResult.parameters[moduleSubRow].at(1),		/** Module type */
+			                moduleInterface.at(1),		/** Module type */
 			                moduleName,
 			                modAddressing,
 			                minPosition,
@@ -2553,9 +2714,9 @@ CliResult ProjectParser::CreateModule(const std::uint8_t nodeId,
 				return CliLogger::GetInstance().GetFailureErrorString(result);
 			}
 
-			CliResult clires = UpdateNodeIdCollection(nodeId, modulePathToXDC, forcedObject,
-			                   forcedSubObject, interfacecUId,
-			                   pResult.parameters[moduleSubRow].at(0),
+			CliResult clires = UpdateNodeIdCollection(nodeId, modulePathToXDC, forcedObjects,
+			                   interfacecUId,
+			                   moduleInterface.at(0),
 			                   modpos);
 			if (!clires.IsSuccessful())
 			{
@@ -2571,66 +2732,53 @@ CliResult ProjectParser::CreateModule(const std::uint8_t nodeId,
 	return CliResult();
 }
 
-CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
+CliResult ProjectParser::CreateModuleObject(const DeviceTemplate& deviceTemplate,
         const std::uint8_t nodeId,
-        const std::vector<std::string>& forcedObject,
-        const std::vector<std::string>& forcedSubObject,
+        const std::unordered_set<std::uint64_t>& forcedObjects,
         const std::string& interfaceId,
         const std::string& modId,
         const std::uint32_t modPosition)
 {
 	try
 	{
-		ParserResult pResult;
-		CliResult clires = pResult.CreateResult(element, kObjectXpathExpression,
-		                                        kFormatStrObjectXpathExpressionModule);
-
+		CliResult clires = deviceTemplate.objectResult;
 		if (!clires.IsSuccessful())
 		{
 			return clires;
 		}
 
-		for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
+		for (const XdcObjectType& object : deviceTemplate.objects)
 		{
-			std::uint32_t objId = 0;
-
-			if (!pResult.parameters[row].at(0).empty())						/** Object Index */
-			{
-				objId = (std::uint32_t)std::stol(pResult.parameters[row].at(0), NULL, 16);
-			}
-
-			std::uint8_t objIdType = 0;
-
-			if (!pResult.parameters[row].at(2).empty())
+			const XdcObjectEntryType& objEntry = object.entry;
+			CliResult convres = objEntry.conversionResult;
+			if (!convres.IsSuccessful())
 			{
-				objIdType = (std::uint8_t)std::stoi(pResult.parameters[row].at(2));
+				return convres;
 			}
 
-			std::string accessType = pResult.parameters[row].at(5);			/** Access Type */
-			std::string dataType = pResult.parameters[row].at(4);			/** data Type */
-			std::string uniqueIdRef = pResult.parameters[row].at(8);		/** UniqueId ref */
-			std::string actualValue = pResult.parameters[row].at(7);		/** Actual value */
-			std::string rangeSelector = pResult.parameters[row].at(11);	/** Range selector */
-
-			if ((accessType.compare("ro") == 0) ||
-			        (accessType.compare("const") == 0))
+			/** The referenced parameter is resolved through the uniqueID index of the XDC */
+			if (!objEntry.uniqueIdRef.empty())
 			{
-				actualValue = "";
+				convres = CheckParameterRef(deviceTemplate, objEntry.uniqueIdRef, false);
+				if (!convres.IsSuccessful())
+				{
+					return convres;
+				}
 			}
 
-			if ((!dataType.empty()) && (uniqueIdRef.empty()))
+			if (objEntry.hasDataType && (objEntry.uniqueIdRef.empty()))
 			{
 				Result res = OpenConfiguratorCore::GetInstance().CreateModuleObject(
 				                 OpenConfiguratorCli::GetInstance().networkName,
 				                 nodeId, interfaceId,
 				                 modId, modPosition,
-				                 objId, GetObjectType(objIdType),
-				                 pResult.parameters[row].at(1),						/** name */
-				                 GetPlkDataType(dataType),
-				                 GetObjAccessType(accessType),
-				                 GetPdoMapping(pResult.parameters[row].at(6)), 		/** PDOmapping */
-				                 pResult.parameters[row].at(3),						/** defaultValue */
-				                 actualValue, rangeSelector);
+				                 objEntry.index, objEntry.objectType,
+				                 objEntry.name,
+				                 objEntry.dataType,
+				                 objEntry.accessType,
+				                 objEntry.pdoMapping,
+				                 objEntry.defaultValue,
+				                 objEntry.actualValue, objEntry.rangeSelector);
 				if (!res.IsSuccessful())
 				{
 					clires = CliLogger::GetInstance().GetFailureErrorString(res);
@@ -2639,13 +2787,13 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 				}
 				else
 				{
-					if ((!pResult.parameters[row].at(9).empty()) || (!pResult.parameters[row].at(10).empty()))
+					if ((!objEntry.lowLimit.empty()) || (!objEntry.highLimit.empty()))
 					{
 						CliResult oiclires;
 						std::uint32_t objIndex = 0;
 
 						oiclires = GetNewObjectIndex(nodeId, interfaceId, modId,
-						                             modPosition, objId, objIndex);
+						                             modPosition, objEntry.index, objIndex);
 						if (!oiclires.IsSuccessful())
 						{
 							LOG_WARN() << CliLogger::GetInstance().GetErrorString(oiclires);
@@ -2656,8 +2804,8 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 							          OpenConfiguratorCli::GetInstance().networkName,
 							          nodeId,
 							          objIndex,
-							          pResult.parameters[row].at(9),				/** lowLimit */
-							          pResult.parameters[row].at(10));			/** highLimit */
+							          objEntry.lowLimit,
+							          objEntry.highLimit);
 							if (!res.IsSuccessful())
 							{
 								CliResult soclires = CliLogger::GetInstance().GetFailureErrorString(res);
@@ -2668,20 +2816,20 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 					}
 				}
 			}
-			else if ((!dataType.empty()) && (!uniqueIdRef.empty()))
+			else if (objEntry.hasDataType && (!objEntry.uniqueIdRef.empty()))
 			{
 				Result res = OpenConfiguratorCore::GetInstance().CreateModuleParameterObject(
 				                 OpenConfiguratorCli::GetInstance().networkName,
 				                 nodeId, interfaceId,
 				                 modId, modPosition,
-				                 objId, GetObjectType(objIdType),
-				                 pResult.parameters[row].at(1),						/** name */
-				                 GetPlkDataType(dataType),
-				                 GetObjAccessType(accessType),
-				                 GetPdoMapping(pResult.parameters[row].at(6)), 		/** PDOmapping */
-				                 uniqueIdRef,
-				                 pResult.parameters[row].at(3),						/** defaultValue */
-				                 actualValue, rangeSelector);
+				                 objEntry.index, objEntry.objectType,
+				                 objEntry.name,
+				                 objEntry.dataType,
+				                 objEntry.accessType,
+				                 objEntry.pdoMapping,
+				                 objEntry.uniqueIdRef,
+				                 objEntry.defaultValue,
+				                 objEntry.actualValue, objEntry.rangeSelector);
 				if (!res.IsSuccessful())
 				{
 					clires = CliLogger::GetInstance().GetFailureErrorString(res);
@@ -2689,21 +2837,21 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 					LOG_WARN() << CliLogger::GetInstance().GetErrorString(clires);
 				}
 			}
-			else if ((dataType.empty()) && (!uniqueIdRef.empty()))
+			else if ((!objEntry.hasDataType) && (!objEntry.uniqueIdRef.empty()))
 			{
 				Result res = OpenConfiguratorCore::GetInstance().CreateModuleParameterObject(
 				                 OpenConfiguratorCli::GetInstance().networkName,
 				                 nodeId, interfaceId,
 				                 modId, modPosition,
-				                 objId,
-				                 GetObjectType(objIdType),
-				                 pResult.parameters[row].at(1),						/** name */
+				                 objEntry.index,
+				                 objEntry.objectType,
+				                 objEntry.name,
 				                 PlkDataType::UNDEFINED,
-				                 GetObjAccessType(accessType),
-				                 GetPdoMapping(pResult.parameters[row].at(6)), 		/** PDOmapping */
-				                 uniqueIdRef,
-				                 pResult.parameters[row].at(3),						/** defaultValue */
-				                 actualValue, rangeSelector);
+				                 objEntry.accessType,
+				                 objEntry.pdoMapping,
+				                 objEntry.uniqueIdRef,
+				                 objEntry.defaultValue,
+				                 objEntry.actualValue, objEntry.rangeSelector);
 				if (!res.IsSuccessful())
 				{
 					clires = CliLogger::GetInstance().GetFailureErrorString(res);
@@ -2712,19 +2860,19 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 				}
 
 			}
-			else if ((dataType.empty()) && (uniqueIdRef.empty()))
+			else if ((!objEntry.hasDataType) && (objEntry.uniqueIdRef.empty()))
 			{
 				Result res = OpenConfiguratorCore::GetInstance().CreateModuleObject(
 				                 OpenConfiguratorCli::GetInstance().networkName,
 				                 nodeId, interfaceId,
 				                 modId, modPosition,
-				                 objId, GetObjectType(objIdType),
-				                 pResult.parameters[row].at(1),						/** name */
-				                 GetPlkDataType(dataType),
-				                 GetObjAccessType(accessType),
-				                 GetPdoMapping(pResult.parameters[row].at(6)), 		/** PDOmapping */
-				                 pResult.parameters[row].at(3),						/** defaultValue */
-				                 actualValue, rangeSelector);
+				                 objEntry.index, objEntry.objectType,
+				                 objEntry.name,
+				                 objEntry.dataType,
+				                 objEntry.accessType,
+				                 objEntry.pdoMapping,
+				                 objEntry.defaultValue,
+				                 objEntry.actualValue, objEntry.rangeSelector);
 				if (!res.IsSuccessful())
 				{
 					clires = CliLogger::GetInstance().GetFailureErrorString(res);
@@ -2733,13 +2881,13 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 				}
 				else
 				{
-					if ((!pResult.parameters[row].at(9).empty()) || (!pResult.parameters[row].at(10).empty()))
+					if ((!objEntry.lowLimit.empty()) || (!objEntry.highLimit.empty()))
 					{
 						CliResult oiclires;
 						std::uint32_t objIndex = 0;
 
 						oiclires = GetNewObjectIndex(nodeId, interfaceId, modId,
-						                             modPosition, objId, objIndex);
+						                             modPosition, objEntry.index, objIndex);
 						if (!oiclires.IsSuccessful())
 						{
 							LOG_WARN() << CliLogger::GetInstance().GetErrorString(oiclires);
@@ -2750,8 +2898,8 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 							          OpenConfiguratorCli::GetInstance().networkName,
 							          nodeId,
 							          objIndex,
-							          pResult.parameters[row].at(9),				/** lowLimit */
-							          pResult.parameters[row].at(10));			/** highLimit */
+							          objEntry.lowLimit,
+							          objEntry.highLimit);
 							if (!res.IsSuccessful())
 							{
 								clires = CliLogger::GetInstance().GetFailureErrorString(res);
@@ -2763,54 +2911,46 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 				}
 			}
 
-			ParserResult subpResult;
-
-			CliResult res = subpResult.CreateResult(element, kSubObjectXpathExpression,
-			                                        kFormatStrSubObjectXpathExpression,
-			                                        pResult.node.at(row));
+			CliResult res = object.subObjectResult;
 			if (!res.IsSuccessful())
 			{
 				LOG_WARN() << CliLogger::GetInstance().GetErrorString(res);
 			}
 			else
 			{
-				for (std::uint32_t subrow = 0; subrow < subpResult.parameters.size(); subrow++)
+				for (const XdcObjectEntryType& subObject : object.subObjects)
 				{
-					std::uint8_t subObjId = 0;
-					std::uint8_t subObjIdType = 0;
-
-					if (!subpResult.parameters[subrow].at(0).empty())
+					CliResult convres = subObject.conversionResult;
+					if (!convres.IsSuccessful())
 					{
-						subObjId = (std::uint8_t)std::stol(subpResult.parameters[subrow].at(0), NULL, 16);
+						return convres;
 					}
-					if (!subpResult.parameters[subrow].at(2).empty())
-					{
-						subObjIdType = (std::uint8_t)std::stoi(subpResult.parameters[subrow].at(2));
-					}
-					std::string subObjaccessType = subpResult.parameters[subrow].at(5);		/** Access type */
-					std::string subObjActualValue = subpResult.parameters[subrow].at(7);	/** Actual value */
-					std::string subObjuniqueIdRef = subpResult.parameters[subrow].at(8);	/** UniqueID ref */
-					std::string subObjdataType = subpResult.parameters[subrow].at(4);		/** Data type */
 
-					if ((subObjaccessType.compare("ro") == 0) ||
-					        (subObjaccessType.compare("const") == 0))
+					/** The referenced parameter is resolved through the uniqueID index of the XDC */
+					if (!subObject.uniqueIdRef.empty())
 					{
-						subObjActualValue = "";
+						convres = CheckParameterRef(deviceTemplate, subObject.uniqueIdRef, false);
+						if (!convres.IsSuccessful())
+						{
+							return convres;
+						}
 					}
 
-					if (subpResult.parameters[subrow].at(8).empty())						/** Is uniqueIdRef empty */
+					std::uint8_t subObjId = (std::uint8_t)subObject.index;
+
+					if (subObject.uniqueIdRef.empty())
 					{
 						Result result = OpenConfiguratorCore::GetInstance().CreateModuleSubObject(
 						                    OpenConfiguratorCli::GetInstance().networkName,
 						                    nodeId, interfaceId,
-						                    modId, modPosition, objId, subObjId,
-						                    GetObjectType(subObjIdType),
-						                    subpResult.parameters[subrow].at(1),						/** sub object name */
-						                    GetPlkDataType(subpResult.parameters[subrow].at(4)), 		/** sub object dataType */
-						                    GetObjAccessType(subObjaccessType),
-						                    GetPdoMapping(subpResult.parameters[subrow].at(6)),			/** sub object PDOmapping */
-						                    subpResult.parameters[subrow].at(3),						/** sub object defaultValue */
-						                    subObjActualValue);
+						                    modId, modPosition, objEntry.index, subObjId,
+						                    subObject.objectType,
+						                    subObject.name,
+						                    subObject.dataType,
+						                    subObject.accessType,
+						                    subObject.pdoMapping,
+						                    subObject.defaultValue,
+						                    subObject.actualValue);
 						if (!result.IsSuccessful())
 						{
 							clires = CliLogger::GetInstance().GetFailureErrorString(result);
@@ -2820,15 +2960,15 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 						else
 						{
 							/** If any one of the sub object lowLimit and highLimit has values */
-							if ((!subpResult.parameters[subrow].at(9).empty()) ||
-							        (!subpResult.parameters[subrow].at(10).empty()))
+							if ((!subObject.lowLimit.empty()) ||
+							        (!subObject.highLimit.empty()))
 							{
 								CliResult oiclires;
 								std::uint32_t objIndex = 0;
 								std::uint32_t subObjIndex = 0;
 
 								oiclires = GetNewObjectIndex(nodeId, interfaceId, modId,
-								                             modPosition, objId, objIndex);
+								                             modPosition, objEntry.index, objIndex);
 								if (!oiclires.IsSuccessful())
 								{
 									LOG_WARN() << CliLogger::GetInstance().GetErrorString(oiclires);
@@ -2849,8 +2989,8 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 										             nodeId,
 										             objIndex,
 										             (std::uint8_t)subObjIndex,
-										             subpResult.parameters[subrow].at(9),			/** sub object lowLimit */
-										             subpResult.parameters[subrow].at(10));			/** sub object highLimit */
+										             subObject.lowLimit,
+										             subObject.highLimit);
 										if (!result.IsSuccessful())
 										{
 											clires = CliLogger::GetInstance().GetFailureErrorString(result);
@@ -2862,21 +3002,21 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 							}
 						}
 					}
-					else if ((!subObjuniqueIdRef.empty()) && (!subObjdataType.empty()))
+					else if (subObject.hasDataType)
 					{
 						/** Both sub object uniqueIdRef and dataType has values */
 						Result result = OpenConfiguratorCore::GetInstance().CreateModuleParameterSubObject(
 						                    OpenConfiguratorCli::GetInstance().networkName,
 						                    nodeId, interfaceId,
-						                    modId, modPosition, objId, subObjId,
-						                    GetObjectType(subObjIdType),
-						                    subpResult.parameters[subrow].at(1),					/** sub object name */
-						                    GetPlkDataType(subObjdataType),
-						                    GetObjAccessType(subObjaccessType),
-						                    GetPdoMapping(subpResult.parameters[subrow].at(6)),		/** sub object PDOmapping */
-						                    subObjuniqueIdRef,
-						                    subpResult.parameters[subrow].at(3),					/** sub object defaultValue */
-						                    subObjActualValue);
+						                    modId, modPosition, objEntry.index, subObjId,
+						                    subObject.objectType,
+						                    subObject.name,
+						                    subObject.dataType,
+						                    subObject.accessType,
+						                    subObject.pdoMapping,
+						                    subObject.uniqueIdRef,
+						                    subObject.defaultValue,
+						                    subObject.actualValue);
 						if (!result.IsSuccessful())
 						{
 							clires = CliLogger::GetInstance().GetFailureErrorString(result);
@@ -2884,20 +3024,20 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 							LOG_WARN() << CliLogger::GetInstance().GetErrorString(clires);
 						}
 					}
-					else if ((!subObjuniqueIdRef.empty()) && (subObjdataType.empty()))
+					else
 					{
-						/** Both sub object uniqueIdRef and dataType has values */
+						/** Sub object uniqueIdRef without dataType */
 						Result result = OpenConfiguratorCore::GetInstance().CreateModuleParameterSubObject(
 						                    OpenConfiguratorCli::GetInstance().networkName,
 						                    nodeId, interfaceId,
-						                    modId, modPosition, objId, subObjId, GetObjectType(subObjIdType),
-						                    subpResult.parameters[subrow].at(1),					/** sub object name */
+						                    modId, modPosition, objEntry.index, subObjId, subObject.objectType,
+						                    subObject.name,
 						                    PlkDataType::UNDEFINED,
-						                    GetObjAccessType(subObjaccessType),
-						                    GetPdoMapping(subpResult.parameters[subrow].at(6)),		/** sub object PDOmapping */
-						                    subObjuniqueIdRef,
-						                    subpResult.parameters[subrow].at(3),					/** sub object defaultValue */
-						                    subObjActualValue);
+						                    subObject.accessType,
+						                    subObject.pdoMapping,
+						                    subObject.uniqueIdRef,
+						                    subObject.defaultValue,
+						                    subObject.actualValue);
 						if (!result.IsSuccessful())
 						{
 							clires = CliLogger::GetInstance().GetFailureErrorString(result);
@@ -2906,9 +3046,8 @@ CliResult ProjectParser::CreateModuleObject(const ParserElement& element,
 						}
 					}
 
-					CliResult result = UpdateForcedObjects(forcedObject, forcedSubObject, nodeId,
-					                                       pResult.parameters[row].at(0), subpResult.parameters[subrow].at(0),
-					                                       objId, subObjId, actualValue, subObjActualValue, true,
+					CliResult result = UpdateForcedObjects(forcedObjects, nodeId,
+					                                       objEntry.index, subObjId, subObject.actualValue, true,
 					                                       interfaceId, modId, modPosition);
 					if (!result.IsSuccessful())
 					{
@@ -2998,8 +3137,7 @@ CliResult ProjectParser::GetNewParameterId(const std::uint8_t nodeId,
 
 CliResult ProjectParser::CreateForcedObjects(const ParserElement& pElement,
         const std::string& xPathExpression,
-        std::vector<std::string>& forcedObj,
-        std::vector<std::string>& forcedSubObj,
+        std::unordered_set<std::uint64_t>& forcedObjects,
         const xercesc::DOMNode* parentNode)
 {
 	ParserResult pResult;
@@ -3016,250 +3154,98 @@ CliResult ProjectParser::CreateForcedObjects(const ParserElement& pElement,
 	{
 		for (std::uint32_t row = 0; row < pResult.parameters.size(); row++)
 		{
-			/** Updates the vector based on existing object */
-			std::string index = pResult.parameters[row].at(0);
-			forcedObj.push_back(index);
-
-			/** Updates the vector based on existing sub-object */
-			std::string subIndex = pResult.parameters[row].at(1);
-			forcedSubObj.push_back(subIndex);
-		}
-	}
-
-	return CliResult();
-}
-
-CliResult ProjectParser::UpdateForcedObjects(const std::vector<std::string>& forcedObject,
-        const std::vector<std::string>& forcedSubObject,
-        const std::uint8_t nodeId,
-        const std::string& objectIndex,
-        const std::string& SubobjectIndex,
-        const std::uint32_t objectId,
-        const std::uint8_t subObjectId,
-        const std::string& objectValue,
-        const std::string& subobjectValue,
-        const bool value,
-        const std::string& interfaceId,
-        const std::string& modId,
-        const std::uint32_t modPosition)
-{
-	if (!forcedObject.empty())
-	{
-		for (std::string subObjectIdOfVector : forcedSubObject)
-		{
-			if (subObjectIdOfVector.compare(SubobjectIndex) == 0)
+			const std::string& index = pResult.parameters[row].at(0);
+			const std::string& subIndex = pResult.parameters[row].at(1);
+			if (index.empty() || subIndex.empty())
 			{
-				for (std::string objectIdOfVector : forcedObject)
-				{
-					if (objectIdOfVector.compare(objectIndex) == 0)
-					{
-						std::uint32_t objectIdOutput = 0;
-						std::uint32_t subObjectIdOutput = 0;
-						Result res;
-
-						if (value)
-						{
-							CliResult oiclires;
-
-							oiclires = GetNewObjectIndex(nodeId, interfaceId, modId,
-							                             modPosition, objectId,
-							                             objectIdOutput);
-							if (!oiclires.IsSuccessful())
-							{
-								LOG_WARN() << CliLogger::GetInstance().GetErrorString(oiclires);
-							}
-							else
-							{
-								CliResult soiclires;
-
-								soiclires = GetNewSubObjectIndex(nodeId,
-								                                 interfaceId,
-								                                 modId, modPosition,
-								                                 subObjectId,
-								                                 subObjectIdOutput);
-								if (!soiclires.IsSuccessful())
-								{
-									LOG_WARN() << CliLogger::GetInstance().GetErrorString(soiclires);
-								}
-								else
-								{
-									res = OpenConfiguratorCore::GetInstance().SetSubObjectActualValue(
-									          OpenConfiguratorCli::GetInstance().networkName,
-									          nodeId, objectIdOutput,
-									          (std::uint8_t)subObjectIdOutput,
-									          subobjectValue, true, false);
-									if (!res.IsSuccessful())
-									{
-										return CliLogger::GetInstance().GetFailureErrorString(res);
-									}
-								}
-							}
-						}
-						else
-						{
-							res = OpenConfiguratorCore::GetInstance().SetSubObjectActualValue(
-							          OpenConfiguratorCli::GetInstance().networkName,
-							          nodeId, objectId, subObjectId,
-							          subobjectValue, true, false);
-							if (!res.IsSuccessful())
-							{
-								return CliLogger::GetInstance().GetFailureErrorString(res);
-							}
-						}
-					}
-				}
+				continue;
 			}
-			else
-			{
-				if (forcedSubObject.empty())
-				{
-					for (std::string object : forcedObject)
-					{
-						if (objectIndex.compare(object) == 0)
-						{
-							std::uint32_t objectIdOutput = 0;
-							Result res;
 
-							if (value)
-							{
-								CliResult oiclires;
+			std::uint32_t objectId = 0;
+			if (!NumberConverter::ToUInt32(index, 16, objectId))
+			{
+				return NumberConverter::GetConversionError(index);
+			}
 
-								oiclires = GetNewObjectIndex(nodeId, interfaceId, modId,
-								                             modPosition, objectId,
-								                             objectIdOutput);
-								if (!oiclires.IsSuccessful())
-								{
-									LOG_WARN() << CliLogger::GetInstance().GetErrorString(oiclires);
-								}
-								else
-								{
-									res = OpenConfiguratorCore::GetInstance().SetObjectActualValue(
-									          OpenConfiguratorCli::GetInstance().networkName,
-									          nodeId, objectIdOutput, objectValue, true, false);
-									if (!res.IsSuccessful())
-									{
-										return CliLogger::GetInstance().GetFailureErrorString(res);
-									}
-								}
-							}
-							else
-							{
-								res = OpenConfiguratorCore::GetInstance().SetObjectActualValue(
-								          OpenConfiguratorCli::GetInstance().networkName,
-								          nodeId, objectId, objectValue, true, false);
-								if (!res.IsSuccessful())
-								{
-									return CliLogger::GetInstance().GetFailureErrorString(res);
-								}
-							}
-						}
-					}
-				}
+			std::uint8_t subObjectId = 0;
+			if (!NumberConverter::ToUInt8(subIndex, 16, subObjectId))
+			{
+				return NumberConverter::GetConversionError(subIndex);
 			}
+
+			/** Updates the set based on the forced sub-object */
+			forcedObjects.insert(GetForcedObjectKey(objectId, subObjectId));
 		}
 	}
 
 	return CliResult();
 }
 
-IEC_Datatype ProjectParser::GetDataType(const std::string& dataType)
-{
-	if (iecdataTypeMap.find(dataType) != iecdataTypeMap.end())
-		return iecdataTypeMap.at(dataType);
-	return IEC_Datatype::UNDEFINED;
-}
-
-ParameterAccess ProjectParser::GetParameterAccess(const std::string& access)
-{
-	if (parameterAccessMap.find(access) != parameterAccessMap.end())
-		return parameterAccessMap.at(access);
-	return ParameterAccess::undefined;
-}
-
-ObjectType ProjectParser::GetObjectType(const std::uint8_t objType)
-{
-	return ObjectType(objType);
-}
-
-PlkDataType ProjectParser::GetPlkDataType(const std::string& plkDataType)
-{
-	if (plkDataType.empty())
-		return PlkDataType::UNDEFINED;
-	return (PlkDataType)std::stoi(plkDataType, NULL, 16);
-}
-
-AccessType ProjectParser::GetObjAccessType(const std::string& accessType)
-{
-	if (accessTypeMap.find(accessType) != accessTypeMap.end())
-		return accessTypeMap.at(accessType);
-	return AccessType::UNDEFINED;
-}
-
-PDOMapping ProjectParser::GetPdoMapping(const std::string& pdoMapp)
+std::uint64_t ProjectParser::GetForcedObjectKey(const std::uint32_t objectId,
+        const std::uint8_t subObjectId)
 {
-	return pdoMappingMap.at(pdoMapp);
+	return ((std::uint64_t) objectId << 8) | subObjectId;
 }
 
-DynamicChannelAccessType ProjectParser::GetDynamicChannelAccessType(const std::string& accessType)
+CliResult ProjectParser::UpdateForcedObjects(const std::unordered_set<std::uint64_t>& forcedObjects,
+        const std::uint8_t nodeId,
+        const std::uint32_t objectId,
+        const std::uint8_t subObjectId,
+        const std::string& subobjectActualValue,
+        const bool moduleCheck,
+        const std::string& interfaceId,
+        const std::string& modId,
+        const std::uint32_t modPosition)
 {
-	if (accessType.compare("readOnly") == 0)
-	{
-		return DynamicChannelAccessType::readOnly;
-	}
-	else if (accessType.compare("writeOnly") == 0)
-	{
-		return DynamicChannelAccessType::writeOnly;
-	}
-	else if (accessType.compare("readWriteOutput") == 0)
+	if (forcedObjects.find(GetForcedObjectKey(objectId, subObjectId)) == forcedObjects.end())
 	{
-		return DynamicChannelAccessType::readWriteOutput;
+		return CliResult();
 	}
 
-	return DynamicChannelAccessType::UNDEFINED;
-}
+	Result res;
 
-ModuleAddressing ProjectParser::GetModuleAddressing(const std::string& moduleAddressing)
-{
-	if (moduleAddressing.compare("manual") == 0)
-	{
-		return ModuleAddressing::MANUAL;
-	}
-	else if (moduleAddressing.compare("position") == 0)
+	if (moduleCheck)
 	{
-		return ModuleAddressing::POSITION;
-	}
-	else if (moduleAddressing.compare("next") == 0)
-	{
-		return ModuleAddressing::NEXT;
-	}
+		std::uint32_t objectIdOutput = 0;
+		std::uint32_t subObjectIdOutput = 0;
 
-	return ModuleAddressing::NEXT;
-}
+		CliResult oiclires = GetNewObjectIndex(nodeId, interfaceId, modId,
+		                                       modPosition, objectId,
+		                                       objectIdOutput);
+		if (!oiclires.IsSuccessful())
+		{
+			LOG_WARN() << CliLogger::GetInstance().GetErrorString(oiclires);
+			return CliResult();
+		}
 
-SortNumber ProjectParser::GetSortNumber(const std::string& sortNumber)
-{
-	if (sortNumber.compare("continuous") == 0)
-	{
-		return SortNumber::CONTINUOUS;
+		CliResult soiclires = GetNewSubObjectIndex(nodeId, interfaceId,
+		                                           modId, modPosition,
+		                                           subObjectId,
+		                                           subObjectIdOutput);
+		if (!soiclires.IsSuccessful())
+		{
+			LOG_WARN() << CliLogger::GetInstance().GetErrorString(soiclires);
+			return CliResult();
+		}
+
+		res = OpenConfiguratorCore::GetInstance().SetSubObjectActualValue(
+		          OpenConfiguratorCli::GetInstance().networkName,
+		          nodeId, objectIdOutput,
+		          (std::uint8_t)subObjectIdOutput,
+		          subobjectActualValue, true, false);
 	}
-	else if (sortNumber.compare("address") == 0)
+	else
 	{
-		return SortNumber::ADDRESS;
+		res = OpenConfiguratorCore::GetInstance().SetSubObjectActualValue(
+		          OpenConfiguratorCli::GetInstance().networkName,
+		          nodeId, objectId, subObjectId,
+		          subobjectActualValue, true, false);
 	}
 
-	return SortNumber::CONTINUOUS;
-}
-
-SortMode ProjectParser::GetSortMode(const std::string& sortMode)
-{
-	if (sortMode.compare("index") == 0)
-	{
-		return SortMode::INDEX;
-	}
-	else if (sortMode.compare("subindex") == 0)
+	if (!res.IsSuccessful())
 	{
-		return SortMode::SUBINDEX;
+		return CliLogger::GetInstance().GetFailureErrorString(res);
 	}
 
-	return SortMode::INDEX;
+	return CliResult();
 }
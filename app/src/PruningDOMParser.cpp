@@ -0,0 +1,186 @@
+/**
+ * \file PruningDOMParser.cpp
+ *
+ * \brief Implementation of PruningDOMParser module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "PruningDOMParser.h"
+
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+/** Elements of XDC files that are never read by the import */
+const char* const kPrunedElements[] =
+{
+	"label",
+	"description",
+	"labelRef",
+	"descriptionRef",
+	"ExternalProfileHandle",
+	"DeviceIdentity",
+	"DeviceFunction"
+};
+
+PruningDOMParser::PruningDOMParser(xercesc::MemoryManager* const documentMemoryManager,
+                                   xercesc::XMLGrammarPool* const grammarPool) :
+	ArenaDOMParser(documentMemoryManager, grammarPool),
+	prunedElementNames(),
+	prunedDepth(0)
+{
+	/** Element names are ASCII, they are widened without a transcoder */
+	for (const char* const element : kPrunedElements)
+	{
+		std::string name(element);
+		prunedElementNames.push_back(std::basic_string<XMLCh>(name.begin(), name.end()));
+	}
+}
+
+PruningDOMParser::~PruningDOMParser()
+{
+}
+
+void PruningDOMParser::resetDocument()
+{
+	/** A parse that failed inside a pruned subtree must not prune the next document */
+	prunedDepth = 0;
+
+	xercesc::XercesDOMParser::resetDocument();
+}
+
+void PruningDOMParser::startDocument()
+{
+	prunedDepth = 0;
+
+	ArenaDOMParser::startDocument();
+}
+
+void PruningDOMParser::startElement(const xercesc::XMLElementDecl& elemDecl,
+                                    const unsigned int urlId,
+                                    const XMLCh* const elemPrefix,
+                                    const xercesc::RefVectorOf<xercesc::XMLAttr>& attrList,
+                                    const XMLSize_t attrCount,
+                                    const bool isEmpty,
+                                    const bool isRoot)
+{
+	if ((prunedDepth > 0) || IsPruned(elemDecl))
+	{
+		/** Empty elements are not followed by an endElement call */
+		if (!isEmpty)
+		{
+			prunedDepth++;
+		}
+		return;
+	}
+
+	xercesc::XercesDOMParser::startElement(elemDecl, urlId, elemPrefix,
+	                                       attrList, attrCount, isEmpty, isRoot);
+}
+
+void PruningDOMParser::endElement(const xercesc::XMLElementDecl& elemDecl,
+                                  const unsigned int urlId,
+                                  const bool isRoot,
+                                  const XMLCh* const elemPrefix)
+{
+	if (prunedDepth > 0)
+	{
+		prunedDepth--;
+		return;
+	}
+
+	xercesc::XercesDOMParser::endElement(elemDecl, urlId, isRoot, elemPrefix);
+}
+
+void PruningDOMParser::docCharacters(const XMLCh* const chars,
+                                     const XMLSize_t length,
+                                     const bool cdataSection)
+{
+	if (prunedDepth == 0)
+	{
+		xercesc::XercesDOMParser::docCharacters(chars, length, cdataSection);
+	}
+}
+
+void PruningDOMParser::ignorableWhitespace(const XMLCh* const chars,
+        const XMLSize_t length,
+        const bool cdataSection)
+{
+	if (prunedDepth == 0)
+	{
+		xercesc::XercesDOMParser::ignorableWhitespace(chars, length, cdataSection);
+	}
+}
+
+void PruningDOMParser::docComment(const XMLCh* const comment)
+{
+	if (prunedDepth == 0)
+	{
+		xercesc::XercesDOMParser::docComment(comment);
+	}
+}
+
+void PruningDOMParser::docPI(const XMLCh* const target,
+                             const XMLCh* const data)
+{
+	if (prunedDepth == 0)
+	{
+		xercesc::XercesDOMParser::docPI(target, data);
+	}
+}
+
+void PruningDOMParser::startEntityReference(const xercesc::XMLEntityDecl& entDecl)
+{
+	if (prunedDepth == 0)
+	{
+		xercesc::XercesDOMParser::startEntityReference(entDecl);
+	}
+}
+
+void PruningDOMParser::endEntityReference(const xercesc::XMLEntityDecl& entDecl)
+{
+	if (prunedDepth == 0)
+	{
+		xercesc::XercesDOMParser::endEntityReference(entDecl);
+	}
+}
+
+bool PruningDOMParser::IsPruned(const xercesc::XMLElementDecl& elemDecl) const
+{
+	const XMLCh* const localName = elemDecl.getBaseName();
+
+	for (const std::basic_string<XMLCh>& prunedName : prunedElementNames)
+	{
+		if (xercesc::XMLString::equals(localName, prunedName.c_str()))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,231 @@
+/**
+ * \file ValidationCache.cpp
+ *
+ * \brief Implementation of ValidationCache module
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "ValidationCache.h"
+#include "DeviceTemplateParser.h"
+
+#include <set>
+
+using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+ValidationCache::ValidationCache() :
+	schemaContentKeys(),
+	cacheMutex()
+{
+}
+
+ValidationCache::~ValidationCache()
+{
+}
+
+ValidationCache& ValidationCache::GetInstance()
+{
+	static ValidationCache instance;
+
+	return instance;
+}
+
+CliResult ValidationCache::GetValidationKey(const std::string& fileName,
+        const std::string& schemaFile,
+        std::string& validationKey)
+{
+	try
+	{
+		std::string schemaKey;
+		{
+			std::lock_guard<std::mutex> lock(cacheMutex);
+
+			std::map<std::string, std::string>::const_iterator it = schemaContentKeys.find(schemaFile);
+			if (it != schemaContentKeys.end())
+			{
+				schemaKey = it->second;
+			}
+		}
+
+		/** A change of the schema or of any file it includes invalidates all
+		    files validated against it */
+		if (schemaKey.empty())
+		{
+			std::vector<std::string> schemaFiles;
+			CliResult res = CollectSchemaFiles(schemaFile, schemaFiles);
+			if (!res.IsSuccessful())
+			{
+				return res;
+			}
+
+			res = DeviceTemplateParser::GetInstance().GetContentKey(schemaFiles, schemaKey);
+			if (!res.IsSuccessful())
+			{
+				return res;
+			}
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			schemaContentKeys.insert(std::make_pair(schemaFile, schemaKey));
+		}
+
+		std::string fileKey;
+		CliResult res = DeviceTemplateParser::GetInstance().GetContentKey(fileName, fileKey);
+		if (!res.IsSuccessful())
+		{
+			return res;
+		}
+
+		validationKey = schemaKey + "_" + fileKey;
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
+
+bool ValidationCache::IsValidated(const std::string& validationKey) const
+{
+	boost::system::error_code errorCode;
+	boost::filesystem::path entry = boost::filesystem::path(OpenConfiguratorCli::GetInstance().validationCacheDirectory) / validationKey;
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	return boost::filesystem::exists(entry, errorCode);
+}
+
+CliResult ValidationCache::AddValidated(const std::string& validationKey)
+{
+	try
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex);
+
+		boost::filesystem::path cacheDirectory(OpenConfiguratorCli::GetInstance().validationCacheDirectory);
+		boost::filesystem::create_directories(cacheDirectory);
+
+		boost::filesystem::path entry = cacheDirectory / validationKey;
+		std::ofstream entryFile(entry.string().c_str(), std::ios::out | std::ios::binary);
+		if (!entryFile.is_open())
+		{
+			boost::format formatter(kMsgValidationNotCached[CliLogger::GetInstance().languageIndex]);
+			formatter % validationKey;
+
+			return CliResult(CliErrorCode::INVALID_PARAMETERS, formatter.str());
+		}
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
+
+CliResult ValidationCache::CollectSchemaFiles(const std::string& schemaFile,
+        std::vector<std::string>& schemaFiles)
+{
+	try
+	{
+		const std::string kSchemaLocationAttribute = "schemaLocation";
+
+		std::set<std::string> visitedFiles;
+		schemaFiles.clear();
+		schemaFiles.push_back(schemaFile);
+		visitedFiles.insert(boost::filesystem::canonical(schemaFile).string());
+
+		/** The list grows while it is walked, every file is read once */
+		for (std::size_t index = 0; index < schemaFiles.size(); index++)
+		{
+			std::ifstream file(schemaFiles.at(index).c_str(), std::ios::in | std::ios::binary);
+			if (!file.is_open())
+			{
+				boost::format formatter(kMsgFileNotExists[CliLogger::GetInstance().languageIndex]);
+				formatter % schemaFiles.at(index);
+
+				return CliResult(CliErrorCode::FILE_NOT_EXISTS, formatter.str());
+			}
+
+			std::ostringstream content;
+			content << file.rdbuf();
+			const std::string text = content.str();
+
+			boost::filesystem::path directory = boost::filesystem::path(schemaFiles.at(index)).parent_path();
+
+			/** Locations of xs:include, xs:import and xs:redefine, relative to the including file */
+			for (std::size_t pos = text.find(kSchemaLocationAttribute); pos != std::string::npos;
+			        pos = text.find(kSchemaLocationAttribute, pos + 1))
+			{
+				std::size_t valuePos = text.find_first_not_of(" \t\r\n", pos + kSchemaLocationAttribute.size());
+				if ((valuePos == std::string::npos) || (text.at(valuePos) != '='))
+				{
+					continue;
+				}
+
+				valuePos = text.find_first_not_of(" \t\r\n", valuePos + 1);
+				if ((valuePos == std::string::npos) || ((text.at(valuePos) != '"') && (text.at(valuePos) != '\'')))
+				{
+					continue;
+				}
+
+				std::size_t valueEnd = text.find(text.at(valuePos), valuePos + 1);
+				if (valueEnd == std::string::npos)
+				{
+					continue;
+				}
+
+				/** Remote schemas are not resolved by the parser either */
+				std::string location = text.substr(valuePos + 1, valueEnd - valuePos - 1);
+				if (location.empty() || (location.find("://") != std::string::npos))
+				{
+					continue;
+				}
+
+				boost::filesystem::path includedFile = directory / location;
+				boost::system::error_code errorCode;
+				if (!boost::filesystem::is_regular_file(includedFile, errorCode))
+				{
+					continue;
+				}
+
+				if (visitedFiles.insert(boost::filesystem::canonical(includedFile).string()).second)
+				{
+					schemaFiles.push_back(includedFile.string());
+				}
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		return CliLogger::GetInstance().GetFailureErrorString(e);
+	}
+
+	return CliResult();
+}
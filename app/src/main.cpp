@@ -37,6 +37,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "OpenConfiguratorCli.h"
+#include "XercesInitializer.h"
 
 using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
 using namespace IndustrialNetwork::POWERLINK::Application;
@@ -45,6 +46,9 @@ using namespace IndustrialNetwork::POWERLINK::Core::CoreConfiguration;
 
 int main(int parameterCount, char* parameter[])
 {
+	/** Xerces is initialized once for all files of the run */
+	XercesInitializer xercesInitializer;
+
 	std::vector<std::string> paramList;
 
 	/** Prepare the parameter list */
@@ -0,0 +1,170 @@
+/**
+ * \file ParameterGroupTest.cpp
+ *
+ * \brief Nested parameter groups of a device template
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "ParserElement.h"
+#include "DeviceTemplateParser.h"
+#include "OpenConfiguratorCli.h"
+#include "XercesInitializer.h"
+#include "CliLogger.h"
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace IndustrialNetwork::POWERLINK::Application;
+using namespace IndustrialNetwork::POWERLINK::Application::CliConstants;
+using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
+
+/** \brief Finds a parameter group of the device template
+  * \param deviceTemplate 	Device template
+  * \param uniqueId 		uniqueID of the group
+  * \return Group with the uniqueID; NULL if there is none
+  */
+const XdcParameterGroupType* FindParameterGroup(const DeviceTemplate& deviceTemplate, const std::string& uniqueId)
+{
+	for (const XdcParameterGroupType& parameterGroup : deviceTemplate.parameterGroups)
+	{
+		/** Columns follow kFormatStrParameterGroupXpathExpression */
+		if (parameterGroup.attributes.at(0) == uniqueId)
+		{
+			return &parameterGroup;
+		}
+	}
+
+	return NULL;
+}
+
+/** \brief Checks the parent and the only parameter reference of a group
+  * \param deviceTemplate 	Device template
+  * \param uniqueId 		uniqueID of the group
+  * \param parentUniqueId 	Expected uniqueID of the parent group
+  * \param uniqueIdRef 		Expected uniqueIDRef of the parameter reference
+  * \param actualValue 		Expected actualValue of the parameter reference
+  * \return true if the group matches; false otherwise
+  */
+bool CheckParameterGroup(const DeviceTemplate& deviceTemplate, const std::string& uniqueId,
+                         const std::string& parentUniqueId, const std::string& uniqueIdRef,
+                         const std::string& actualValue)
+{
+	const XdcParameterGroupType* parameterGroup = FindParameterGroup(deviceTemplate, uniqueId);
+	if (parameterGroup == NULL)
+	{
+		std::cerr << "Parameter group \"" << uniqueId << "\" was not extracted." << std::endl;
+		return false;
+	}
+
+	if (parameterGroup->parentUniqueId != parentUniqueId)
+	{
+		std::cerr << "Parameter group \"" << uniqueId << "\" has the parent \""
+		          << parameterGroup->parentUniqueId << "\"." << std::endl;
+		return false;
+	}
+
+	/** Columns follow kFormatStrChildParameterRefXpathExpression */
+	if ((parameterGroup->parameterRefs.size() != 1)
+	        || (parameterGroup->parameterRefs[0].at(0) != uniqueIdRef)
+	        || (parameterGroup->parameterRefs[0].at(2) != actualValue))
+	{
+		std::cerr << "Parameter group \"" << uniqueId << "\" does not hold only the reference to \""
+		          << uniqueIdRef << "\"." << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc != 2)
+	{
+		std::cerr << "Usage: ParameterGroupTest <XdcFile>" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	XercesInitializer xercesInitializer;
+
+	ParserElement element(argv[1], kXdcSchemaDefinitionFileName, kXDDNamespace, true);
+	CliResult res = element.CreateUnvalidatedElement();
+	if (!res.IsSuccessful())
+	{
+		std::cerr << CliLogger::GetInstance().GetErrorString(res) << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	DeviceTemplate deviceTemplate;
+	res = DeviceTemplateParser::GetInstance().CreateDeviceTemplate(element, deviceTemplate);
+	if (!res.IsSuccessful())
+	{
+		std::cerr << CliLogger::GetInstance().GetErrorString(res) << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	/** Groups below the second level are extracted as well */
+	if (deviceTemplate.parameterGroups.size() != 3)
+	{
+		std::cerr << deviceTemplate.parameterGroups.size() << " parameter groups extracted instead of 3." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	int result = EXIT_SUCCESS;
+
+	/** CreateParameterGroup relies on the document order to create a parent first */
+	const char* const groupOrder[] = { "G_Outer", "G_Middle", "G_Inner" };
+	for (std::size_t index = 0; index < 3; ++index)
+	{
+		if (deviceTemplate.parameterGroups[index].attributes.at(0) != groupOrder[index])
+		{
+			std::cerr << "Parameter group \"" << groupOrder[index] << "\" is not at position "
+			          << index << "." << std::endl;
+			result = EXIT_FAILURE;
+		}
+	}
+
+	if (!CheckParameterGroup(deviceTemplate, "G_Outer", "", "P_Outer", "1"))
+	{
+		result = EXIT_FAILURE;
+	}
+
+	/** The reference without actualValue stays with the group which contains it */
+	if (!CheckParameterGroup(deviceTemplate, "G_Middle", "G_Outer", "P_Middle", ""))
+	{
+		result = EXIT_FAILURE;
+	}
+
+	if (!CheckParameterGroup(deviceTemplate, "G_Inner", "G_Middle", "P_Inner", "3"))
+	{
+		result = EXIT_FAILURE;
+	}
+
+	return result;
+}
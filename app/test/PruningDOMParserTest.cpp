@@ -0,0 +1,163 @@
+/**
+ * \file PruningDOMParserTest.cpp
+ *
+ * \brief Reuse test of the pooled PruningDOMParser after a failed parse
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "PruningDOMParser.h"
+#include "ParserPool.h"
+#include "XercesInitializer.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <xercesc/util/PlatformUtils.hpp>
+#include <xercesc/framework/MemBufInputSource.hpp>
+#include <xercesc/dom/DOM.hpp>
+
+using namespace IndustrialNetwork::POWERLINK::Application;
+
+/** XDC ending inside a pruned subtree */
+const char kTruncatedXdc[] =
+    "<ISO15745ProfileContainer><ISO15745Profile><ProfileBody>"
+    "<description lang=\"en\">Truncated";
+
+/** Valid XDC with a pruned and a kept element */
+const char kValidXdc[] =
+    "<ISO15745ProfileContainer><ISO15745Profile><ProfileBody>"
+    "<description lang=\"en\">Dropped</description>"
+    "<ObjectList><Object index=\"1000\"/></ObjectList>"
+    "</ProfileBody></ISO15745Profile></ISO15745ProfileContainer>";
+
+/** \brief Parses a document from memory, fatal errors are expected for the truncated one
+  * \param parser 		Parser to be used
+  * \param document 	Document text
+  * \return Nothing
+  */
+void ParseDocument(xercesc::XercesDOMParser& parser, const char* document)
+{
+	xercesc::MemBufInputSource source(reinterpret_cast<const XMLByte*>(document),
+	                                  std::strlen(document), "PruningDOMParserTest");
+	try
+	{
+		parser.parse(source);
+	}
+	catch (...)
+	{
+		/** Fatal errors are thrown without an error handler */
+	}
+}
+
+/** \brief Counts the elements of a document with a local name
+  * \param document 	Parsed document
+  * \param name 		Local name of the elements
+  * \return Number of elements
+  */
+XMLSize_t CountElements(xercesc::DOMDocument* document, const char* name)
+{
+	XMLCh* tagName = xercesc::XMLString::transcode(name);
+	XMLSize_t count = document->getElementsByTagName(tagName)->getLength();
+	xercesc::XMLString::release(&tagName);
+
+	return count;
+}
+
+/** \brief Checks the document of a parser after the valid XDC
+  * \param parser 		Parser of the document
+  * \return true if the document is complete and pruned; false otherwise
+  */
+bool CheckValidDocument(xercesc::XercesDOMParser& parser)
+{
+	xercesc::DOMDocument* document = parser.getDocument();
+	if ((document == NULL) || (document->getDocumentElement() == NULL))
+	{
+		std::cerr << "Valid document after a failed parse has no root element." << std::endl;
+		return false;
+	}
+
+	if (CountElements(document, "Object") != 1)
+	{
+		std::cerr << "Valid document after a failed parse lost its objects." << std::endl;
+		return false;
+	}
+
+	if (CountElements(document, "description") != 0)
+	{
+		std::cerr << "Pruned element is part of the document." << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+int main()
+{
+	int result = EXIT_SUCCESS;
+
+	XercesInitializer xercesInitializer;
+
+	/** The first parse fails inside the pruned description */
+	PooledParser* pooledParser = ParserPool::GetInstance().Acquire(true);
+	xercesc::XercesDOMParser* parser = pooledParser->parser;
+	parser->setValidationScheme(xercesc::XercesDOMParser::Val_Never);
+	ParseDocument(*parser, kTruncatedXdc);
+	ParserPool::GetInstance().Release(pooledParser);
+
+	if (pooledParser->memory.GetAllocatedBytes() != 0)
+	{
+		std::cerr << "Arena of a released parser is not rewound." << std::endl;
+		result = EXIT_FAILURE;
+	}
+
+	/** The same parser object has to build the next document completely */
+	PooledParser* reusedParser = ParserPool::GetInstance().Acquire(true);
+	if ((reusedParser != pooledParser) || (reusedParser->parser != parser))
+	{
+		std::cerr << "Released parser is not reused." << std::endl;
+		result = EXIT_FAILURE;
+	}
+
+	reusedParser->parser->setValidationScheme(xercesc::XercesDOMParser::Val_Never);
+	ParseDocument(*reusedParser->parser, kValidXdc);
+	if (!CheckValidDocument(*reusedParser->parser))
+	{
+		result = EXIT_FAILURE;
+	}
+	else if (reusedParser->memory.GetAllocatedBytes() == 0)
+	{
+		std::cerr << "Document is not allocated from the arena." << std::endl;
+		result = EXIT_FAILURE;
+	}
+	ParserPool::GetInstance().Release(reusedParser);
+
+	return result;
+}
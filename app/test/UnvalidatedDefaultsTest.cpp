@@ -0,0 +1,120 @@
+/**
+ * \file UnvalidatedDefaultsTest.cpp
+ *
+ * \brief Schema attribute defaults of the unvalidated parse
+ *
+ * \author Kalycito Infotech Private Limited
+ *
+ * \version 1.0
+ *
+ */
+/*------------------------------------------------------------------------------
+Copyright (c) 2016, Kalycito Infotech Private Limited, INDIA.
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+#include "ParserElement.h"
+#include "ParserResult.h"
+#include "OpenConfiguratorCli.h"
+#include "CliConstants.h"
+#include "XercesInitializer.h"
+#include "CliLogger.h"
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace IndustrialNetwork::POWERLINK::Application;
+using namespace IndustrialNetwork::POWERLINK::Application::CliConstants;
+using namespace IndustrialNetwork::POWERLINK::Application::ErrorHandling;
+
+/** Default of the CN attribute name in the project schema */
+const std::string kDefaultCnName = "POWERLINK CN";
+
+/** Default of the CN attribute enabled in the project schema */
+const std::string kDefaultCnEnabled = "true";
+
+/** \brief Parses the project file and reads the attributes of its CN
+  * \param file 		Project file
+  * \param validate 	true to validate against the schema; false otherwise
+  * \param name 		Value of the attribute name output
+  * \param enabled 		Value of the attribute enabled output
+  * \return true if the CN was read; false otherwise
+  */
+bool GetCnAttributes(const std::string& file, bool validate, std::string& name, std::string& enabled)
+{
+	ParserElement element(file, kXmlSchemaDefinitionFileName, kProjectNamespace, false);
+
+	CliResult res = validate ? element.CreateElement() : element.CreateUnvalidatedElement();
+	if (!res.IsSuccessful())
+	{
+		std::cerr << CliLogger::GetInstance().GetErrorString(res) << std::endl;
+		return false;
+	}
+
+	ParserResult cnResult;
+	res = cnResult.CreateResult(element, kCnXpathExpression, kFormatStrCnXpathExpression);
+	if (!res.IsSuccessful() || (cnResult.parameters.size() != 1))
+	{
+		std::cerr << "CN of the project file not found." << std::endl;
+		return false;
+	}
+
+	/** Columns follow kFormatStrCnXpathExpression */
+	name = cnResult.parameters[0].at(2);
+	enabled = cnResult.parameters[0].at(3);
+
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc != 2)
+	{
+		std::cerr << "Usage: UnvalidatedDefaultsTest <ProjectFile>" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	int result = EXIT_SUCCESS;
+
+	XercesInitializer xercesInitializer;
+
+	/** Both parses have to apply the defaults of the omitted attributes */
+	const bool validateSchema[] = { true, false };
+	for (std::size_t index = 0; index < 2; ++index)
+	{
+		std::string name;
+		std::string enabled;
+		if (!GetCnAttributes(argv[1], validateSchema[index], name, enabled))
+		{
+			result = EXIT_FAILURE;
+		}
+		else if ((name != kDefaultCnName) || (enabled != kDefaultCnEnabled))
+		{
+			std::cerr << (validateSchema[index] ? "Validated" : "Unvalidated")
+			          << " parse lost the schema defaults, name=\"" << name
+			          << "\" enabled=\"" << enabled << "\"." << std::endl;
+			result = EXIT_FAILURE;
+		}
+	}
+
+	return result;
+}